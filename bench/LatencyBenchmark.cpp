@@ -0,0 +1,200 @@
+#include "host/FakeModule.h"
+
+#include <buttoncombo/api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Measures the time from injecting a button state sample into the (fake) module until the combo callback runs, and
+ * the cost of evaluating one input frame for all nine controllers, for a growing number of registered combos.
+ * Results are written as JSON to stdout, or to the file passed as first argument.
+ */
+
+namespace {
+    constexpr ButtonComboModule_ControllerTypes CONTROLLERS[] = {
+            BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0,
+            BUTTON_COMBO_MODULE_CONTROLLER_VPAD_1,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_2,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_3,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_4,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_5,
+            BUTTON_COMBO_MODULE_CONTROLLER_WPAD_6,
+    };
+
+    constexpr ButtonComboModule_Buttons BUTTON_POOL[] = {
+            BCMPAD_BUTTON_A,
+            BCMPAD_BUTTON_B,
+            BCMPAD_BUTTON_X,
+            BCMPAD_BUTTON_Y,
+            BCMPAD_BUTTON_L,
+            BCMPAD_BUTTON_R,
+            BCMPAD_BUTTON_ZL,
+            BCMPAD_BUTTON_ZR,
+            BCMPAD_BUTTON_UP,
+            BCMPAD_BUTTON_DOWN,
+            BCMPAD_BUTTON_LEFT,
+            BCMPAD_BUTTON_RIGHT,
+    };
+
+    constexpr uint32_t COMBO_COUNTS[] = {1, 10, 100, 1000, 10000};
+    constexpr uint32_t FRAME_COUNT    = 600;
+    constexpr OSTime FRAME_TIME       = OSMillisecondsToTicks(16);
+    constexpr uint32_t HOLD_DURATION  = 100;
+
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point sInjectStart;
+    std::vector<int64_t> sLatencies;
+
+    // Deterministic, so results are comparable between runs.
+    uint32_t NextRandom(uint32_t &state) {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    ButtonComboModule_Buttons RandomButtons(uint32_t &state, const uint32_t maxButtons) {
+        auto buttons       = static_cast<ButtonComboModule_Buttons>(0);
+        const uint32_t num = 1 + NextRandom(state) % maxButtons;
+        for (uint32_t i = 0; i < num; i++) {
+            buttons |= BUTTON_POOL[NextRandom(state) % std::size(BUTTON_POOL)];
+        }
+        return buttons;
+    }
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sLatencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sInjectStart).count());
+    }
+
+    int64_t Percentile(std::vector<int64_t> &values, const double percentile) {
+        if (values.empty()) {
+            return 0;
+        }
+        const auto index = static_cast<size_t>(percentile * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<ptrdiff_t>(index), values.end());
+        return values[index];
+    }
+
+    struct Result {
+        uint32_t comboCount;
+        uint64_t triggers;
+        int64_t latencyP50;
+        int64_t latencyP99;
+        int64_t latencyMax;
+        int64_t frameMean;
+        int64_t frameP50;
+        int64_t frameP99;
+        int64_t frameMax;
+    };
+
+    Result Run(const uint32_t comboCount) {
+        std::vector<ButtonComboModule::ButtonCombo> combos;
+        combos.reserve(comboCount);
+
+        uint32_t random = 0x1234;
+        for (uint32_t i = 0; i < comboCount; i++) {
+            const auto buttons  = RandomButtons(random, 3);
+            const bool observer = (i / 2) % 2 != 0;
+            ButtonComboModule_ComboStatus status;
+            auto res = (i % 2 == 0)
+                               ? ButtonComboModule::TryCreateComboPressDownEx("bench", BUTTON_COMBO_MODULE_CONTROLLER_ALL, buttons, OnCombo, nullptr, observer, status)
+                               : ButtonComboModule::TryCreateComboHoldEx("bench", BUTTON_COMBO_MODULE_CONTROLLER_ALL, buttons, HOLD_DURATION, OnCombo, nullptr, observer, status);
+            if (!res) {
+                fprintf(stderr, "Failed to create combo: %s\n", ButtonComboModule::GetStatusStr(res.error()));
+                continue;
+            }
+            combos.push_back(std::move(*res));
+        }
+
+        sLatencies.clear();
+        sLatencies.reserve(static_cast<size_t>(FRAME_COUNT) * std::size(CONTROLLERS) * 8);
+        std::vector<int64_t> frameTimes;
+        frameTimes.reserve(FRAME_COUNT);
+
+        ButtonComboModule_Buttons held[std::size(CONTROLLERS)] = {};
+        OSTime sampleTime                                      = 0;
+        for (uint32_t frame = 0; frame < FRAME_COUNT; frame++) {
+            // Change the held buttons every few frames, so hold combos get a chance to trigger.
+            for (uint32_t c = 0; c < std::size(CONTROLLERS); c++) {
+                if ((frame + c) % 8 == 0) {
+                    held[c] = RandomButtons(random, 4);
+                } else if ((frame + c) % 8 == 7) {
+                    held[c] = static_cast<ButtonComboModule_Buttons>(0);
+                }
+            }
+
+            const auto frameStart = Clock::now();
+            for (uint32_t c = 0; c < std::size(CONTROLLERS); c++) {
+                sInjectStart = Clock::now();
+                FakeModule::InjectInput(CONTROLLERS[c], held[c], sampleTime);
+            }
+            frameTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - frameStart).count());
+            sampleTime += FRAME_TIME;
+        }
+
+        Result result     = {};
+        result.comboCount = static_cast<uint32_t>(combos.size());
+        result.triggers   = sLatencies.size();
+        result.latencyMax = sLatencies.empty() ? 0 : *std::max_element(sLatencies.begin(), sLatencies.end());
+        result.latencyP50 = Percentile(sLatencies, 0.50);
+        result.latencyP99 = Percentile(sLatencies, 0.99);
+        int64_t frameSum  = 0;
+        for (const auto time : frameTimes) {
+            frameSum += time;
+        }
+        result.frameMean = frameSum / static_cast<int64_t>(frameTimes.size());
+        result.frameMax  = *std::max_element(frameTimes.begin(), frameTimes.end());
+        result.frameP50  = Percentile(frameTimes, 0.50);
+        result.frameP99  = Percentile(frameTimes, 0.99);
+        return result;
+    }
+} // namespace
+
+int main(int argc, char **argv) {
+    FILE *out = stdout;
+    if (argc > 1 && (out = fopen(argv[1], "w")) == nullptr) {
+        fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    if (const auto res = ButtonComboModule_InitLibrary(); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        fprintf(stderr, "ButtonComboModule_InitLibrary failed: %s\n", ButtonComboModule_GetStatusStr(res));
+        return 1;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"benchmark\": \"input_to_callback_latency\",\n");
+    fprintf(out, "  \"unit\": \"ns\",\n");
+    fprintf(out, "  \"controllers\": %zu,\n", std::size(CONTROLLERS));
+    fprintf(out, "  \"frames\": %u,\n", FRAME_COUNT);
+    fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < std::size(COMBO_COUNTS); i++) {
+        const auto r = Run(COMBO_COUNTS[i]);
+        fprintf(out,
+                "    {\"combos\": %u, \"triggers\": %" PRIu64 ", "
+                "\"latency\": {\"p50\": %" PRId64 ", \"p99\": %" PRId64 ", \"max\": %" PRId64 "}, "
+                "\"frame_eval\": {\"mean\": %" PRId64 ", \"p50\": %" PRId64 ", \"p99\": %" PRId64 ", \"max\": %" PRId64 "}}%s\n",
+                r.comboCount, r.triggers,
+                r.latencyP50, r.latencyP99, r.latencyMax,
+                r.frameMean, r.frameP50, r.frameP99, r.frameMax,
+                i + 1 < std::size(COMBO_COUNTS) ? "," : "");
+    }
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+
+    ButtonComboModule_DeInitLibrary();
+    if (FakeModule::GetComboCount() != 0 || FakeModule::GetAcquireCount() != 0) {
+        fprintf(stderr, "Leaked %u combo(s), module acquired %d time(s)\n", FakeModule::GetComboCount(), FakeModule::GetAcquireCount());
+        return 1;
+    }
+
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
\ No newline at end of file
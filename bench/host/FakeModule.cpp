@@ -0,0 +1,1092 @@
+#include "FakeModule.h"
+
+#include <buttoncombo/api.h>
+
+#include <coreinit/dynload.h>
+#include <coreinit/thread.h>
+#include <proc_ui/procui.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr uint32_t CONTROLLER_COUNT = 9;
+
+    struct ControllerState {
+        bool pressed                                  = false;
+        bool holdFired                                = false;
+        OSTime holdStart                              = 0;
+        bool released                                 = false; // Was released at least once, releaseTime is valid
+        OSTime releaseTime                            = 0;
+        ButtonComboModule_Buttons stickButtons        = {};
+        ButtonComboModule_TimelineState timelineState = BUTTON_COMBO_MODULE_TIMELINE_STATE_IDLE;
+    };
+
+    struct Group {
+        bool enabled = true;
+    };
+
+    struct Detection {
+        bool active = false;
+        ButtonComboModule_DetectButtonComboOptions options;
+        ButtonComboModule_DetectButtonComboCallback callback;
+        void *context;
+        // Buttons of each controller and since when they have been held unchanged.
+        ButtonComboModule_Buttons buttons[CONTROLLER_COUNT];
+        OSTime heldSince[CONTROLLER_COUNT];
+    };
+
+    struct Combo {
+        std::string label;
+        Group *group       = nullptr;
+        bool conflict      = false;
+        bool suspendExempt = false;
+        ButtonComboModule_CallbackOptions callbackOptions;
+        ButtonComboModule_ComboCallbackEx callbackEx;
+        ButtonComboModule_ButtonComboInfoEx info;
+        ButtonComboModule_ComboExpression expression;
+        ButtonComboModule_TriggerFilter filter = {};
+        bool dispatched                        = false; // Triggered at least once, lastDispatch is valid
+        OSTime lastDispatch                    = 0;
+        uint32_t suppressedCount               = 0;
+        ButtonComboModule_StickDirectionOptions stickOptions = {.deadzone   = BUTTON_COMBO_MODULE_STICK_DEADZONE_DEFAULT,
+                                                                .hysteresis = BUTTON_COMBO_MODULE_STICK_HYSTERESIS_DEFAULT};
+        ControllerState state[CONTROLLER_COUNT];
+    };
+
+    // Accumulated since the process has started, there is no module that could be reloaded.
+    struct Counters {
+        uint64_t frames              = 0;
+        OSTime totalFrameEvalTime    = 0;
+        OSTime peakFrameEvalTime     = 0;
+        uint64_t callbacksDispatched = 0;
+        uint64_t callbacksOverBudget = 0;
+        uint32_t callbackBudgetInUs  = 0;
+    };
+
+    std::vector<std::unique_ptr<Combo>> sCombos;
+    std::vector<std::unique_ptr<Group>> sGroups;
+    ButtonComboModule_ControllerState sControllerStates[CONTROLLER_COUNT];
+    Detection sDetection;
+    Counters sCounters;
+    ButtonComboModule_BatchCallback sBatchCallback = nullptr;
+    void *sBatchContext                            = nullptr;
+    ButtonComboModule_APIVersion sApiVersion      = 2;
+    std::string sMissingExport;
+    std::atomic<int32_t> sAcquireCount            = 0;
+    std::atomic<OSTime> sSampleTime               = 0;
+    uint32_t sRealInputMask                       = 0;
+    ButtonComboModule_TimelineRecorder *sRecorder = nullptr;
+    bool sCallbacksUnlocked                       = false;
+    bool sClientSuspended                         = false;
+    ProcUICallback sForegroundCallbacks[2]        = {}; // PROCUI_CALLBACK_ACQUIRE, PROCUI_CALLBACK_RELEASE
+    void *sForegroundCallbackParams[2]            = {};
+
+    // Serializes all exports and host functions. Recursive, because callbacks run with the lock held and may call back
+    // into the module.
+    std::recursive_mutex sMutex;
+
+    Combo *FindCombo(const ButtonComboModule_ComboHandle handle) {
+        for (const auto &combo : sCombos) {
+            if (combo.get() == handle.handle) {
+                return combo.get();
+            }
+        }
+        return nullptr;
+    }
+
+    Group *FindGroup(const ButtonComboModule_ComboGroupHandle handle) {
+        for (const auto &group : sGroups) {
+            if (group.get() == handle.handle) {
+                return group.get();
+            }
+        }
+        return nullptr;
+    }
+
+    bool IsDisabled(const Combo &combo) {
+        return combo.group != nullptr && !combo.group->enabled;
+    }
+
+    bool IsHoldType(const ButtonComboModule_ComboType type) {
+        return type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD || type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER;
+    }
+
+    bool IsObserverType(const ButtonComboModule_ComboType type) {
+        return type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER || type == BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER;
+    }
+
+    // Returns true if every button state that matches `a` also matches `b`. Conservative for anyOf masks.
+    bool Implies(const ButtonComboModule_ComboExpression &a, const ButtonComboModule_ComboExpression &b) {
+        if ((b.required & ~a.required) != 0 || (b.forbidden & ~a.forbidden) != 0) {
+            return false;
+        }
+        for (const auto maskB : b.anyOf) {
+            if (maskB == 0 || (maskB & a.required) != 0) {
+                continue;
+            }
+            if (std::none_of(std::begin(a.anyOf), std::end(a.anyOf), [maskB](const auto maskA) { return maskA != 0 && (maskA & ~maskB) == 0; })) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Two combos conflict if every state that triggers one of them also triggers the other one. Only VALID
+    // non-observer combos block other combos.
+    bool GetConflictKind(const ButtonComboModule_ComboExpression &expression,
+                         const ButtonComboModule_ControllerTypes controllerMask,
+                         const Combo &registered,
+                         ButtonComboModule_ConflictKind &outKind) {
+        if (IsObserverType(registered.info.type) || registered.conflict || IsDisabled(registered) ||
+            (registered.info.basicCombo.controllerMask & controllerMask) == 0) {
+            return false;
+        }
+        const bool checkedImpliesRegistered = Implies(expression, registered.expression);
+        const bool registeredImpliesChecked = Implies(registered.expression, expression);
+        if (checkedImpliesRegistered && registeredImpliesChecked) {
+            outKind = BUTTON_COMBO_MODULE_CONFLICT_KIND_IDENTICAL;
+        } else if (checkedImpliesRegistered) {
+            outKind = BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET;
+        } else if (registeredImpliesChecked) {
+            outKind = BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool HasConflict(const ButtonComboModule_ComboExpression &expression, const ButtonComboModule_ControllerTypes controllerMask, const Combo *self) {
+        ButtonComboModule_ConflictKind kind;
+        return std::any_of(sCombos.begin(), sCombos.end(), [&](const auto &combo) {
+            return combo.get() != self && GetConflictKind(expression, controllerMask, *combo, kind);
+        });
+    }
+
+    void UpdateConflict(Combo &combo) {
+        combo.conflict = !IsObserverType(combo.info.type) && HasConflict(combo.expression, combo.info.basicCombo.controllerMask, &combo);
+    }
+
+    ButtonComboModule_ComboStatus GetStatus(const Combo &combo) {
+        if (IsDisabled(combo)) {
+            return BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED;
+        }
+        return combo.conflict ? BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT : BUTTON_COMBO_MODULE_COMBO_STATUS_VALID;
+    }
+
+    ButtonComboModule_Error ListConflicts(const ButtonComboModule_ComboExpression &expression,
+                                          const ButtonComboModule_ControllerTypes controllerMask,
+                                          const Combo *self,
+                                          ButtonComboModule_ConflictInfo *outConflicts,
+                                          const uint32_t maxCount,
+                                          uint32_t *outCount) {
+        *outCount = 0;
+        for (const auto &combo : sCombos) {
+            ButtonComboModule_ConflictKind kind;
+            if (combo.get() == self || !GetConflictKind(expression, controllerMask, *combo, kind)) {
+                continue;
+            }
+            if (*outCount < maxCount) {
+                auto &info          = outConflicts[*outCount];
+                info                = {};
+                info.handle         = ButtonComboModule_ComboHandle(combo.get());
+                info.type           = combo->info.type;
+                info.controllerMask = combo->info.basicCombo.controllerMask;
+                info.combo          = combo->expression.required;
+                info.kind           = kind;
+                strncpy(info.label, combo->label.c_str(), sizeof(info.label) - 1);
+            }
+            (*outCount)++;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    bool IsValidExpression(const ButtonComboModule_ComboExpression &expression) {
+        uint32_t any = 0;
+        for (const auto mask : expression.anyOf) {
+            any |= mask;
+        }
+        return (expression.required != 0 || any != 0) && (expression.required & expression.forbidden) == 0;
+    }
+
+    // Empty anyOf masks have to match, so they are mapped to a test that is always true.
+    bool MatchesExpression(const ButtonComboModule_ComboExpression &expression, const uint32_t held) {
+        uint32_t matches = (held & expression.required) == expression.required;
+        for (const auto mask : expression.anyOf) {
+            matches &= ((held & mask) != 0) | (mask == 0);
+        }
+        return matches & ((held & expression.forbidden) == 0);
+    }
+
+    // Cooldown is measured from the last dispatched trigger, debounce from the release before the current press.
+    bool IsFiltered(const Combo &combo, const ControllerState &state, const OSTime sampleTime) {
+        const auto &filter = combo.filter;
+        if (combo.dispatched && filter.cooldownInMs != 0 && sampleTime - combo.lastDispatch < OSMillisecondsToTicks(filter.cooldownInMs)) {
+            return true;
+        }
+        return state.released && filter.debounceInMs != 0 && state.holdStart - state.releaseTime < OSMillisecondsToTicks(filter.debounceInMs);
+    }
+
+    void Transition(Combo &combo,
+                    const uint32_t index,
+                    const ButtonComboModule_ControllerTypes controller,
+                    const ButtonComboModule_TimelineState state,
+                    const OSTime sampleTime,
+                    const uint32_t heldForInMs) {
+        auto &current = combo.state[index].timelineState;
+        if (sRecorder != nullptr) {
+            sRecorder->events[sRecorder->totalCount++ % sRecorder->capacity] = {.sampleTime    = sampleTime,
+                                                                                 .handle        = ButtonComboModule_ComboHandle(&combo),
+                                                                                 .controller    = controller,
+                                                                                 .previousState = current,
+                                                                                 .state         = state,
+                                                                                 .heldForInMs   = heldForInMs};
+        }
+        current = state;
+    }
+
+    // The abort combo is checked on all controllers, the detected buttons have to be held unchanged.
+    void EvaluateDetection(const uint32_t index, const ButtonComboModule_ControllerTypes controller, const ButtonComboModule_Buttons buttons, const OSTime sampleTime) {
+        auto &detection = sDetection;
+        if (!detection.active) {
+            return;
+        }
+        if (buttons != detection.buttons[index]) {
+            detection.buttons[index]   = buttons;
+            detection.heldSince[index] = sampleTime;
+        }
+        const auto heldForInMs = static_cast<uint32_t>(OSTicksToMilliseconds(sampleTime - detection.heldSince[index]));
+        const auto &options    = detection.options;
+        ButtonComboModule_Error result;
+        if (options.abortButtonCombo != 0 && (buttons & options.abortButtonCombo) == options.abortButtonCombo && heldForInMs >= options.holdAbortForInMs) {
+            result = BUTTON_COMBO_MODULE_ERROR_ABORTED;
+        } else if ((options.controllerMask & controller) != 0 && buttons != 0 && heldForInMs >= options.holdComboForInMs) {
+            result = BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+        } else {
+            return;
+        }
+        detection.active = false;
+        detection.callback(result, result == BUTTON_COMBO_MODULE_ERROR_SUCCESS ? buttons : static_cast<ButtonComboModule_Buttons>(0), detection.context);
+    }
+
+    // Counts the callback and checks it against the callback budget.
+    template <typename Callback>
+    void RunCallback(Callback &&callback) {
+        const auto start = OSGetSystemTime();
+        callback();
+        sCounters.callbacksDispatched++;
+        if (sCounters.callbackBudgetInUs != 0 && OSTicksToMicroseconds(OSGetSystemTime() - start) > sCounters.callbackBudgetInUs) {
+            sCounters.callbacksOverBudget++;
+        }
+    }
+
+    uint32_t Evaluate(const ButtonComboModule_ControllerTypes controller,
+                      const ButtonComboModule_Buttons buttons,
+                      const FakeModule::StickPosition leftStick,
+                      const FakeModule::StickPosition rightStick,
+                      const OSTime sampleTime) {
+        const auto start   = OSGetSystemTime();
+        const auto index   = static_cast<uint32_t>(__builtin_ctz(static_cast<uint32_t>(controller)));
+        uint32_t triggered = 0;
+        // Each sample is one input frame of its controller.
+        std::vector<ButtonComboModule_TriggerRecord> batch;
+
+        const auto stickButtons  = ButtonComboModule_GetStickDirectionButtons(nullptr, leftStick.x, leftStick.y, rightStick.x, rightStick.y, sControllerStates[index].buttons);
+        sControllerStates[index] = {.controller = controller, .buttons = buttons | stickButtons, .sampleTime = sampleTime, .connected = true};
+        EvaluateDetection(index, controller, buttons, sampleTime);
+
+        for (const auto &combo : sCombos) {
+            if ((combo->info.basicCombo.controllerMask & controller) == 0 || IsDisabled(*combo) || combo->conflict ||
+                (sClientSuspended && !combo->suspendExempt)) {
+                continue;
+            }
+            auto &state         = combo->state[index];
+            state.stickButtons  = ButtonComboModule_GetStickDirectionButtons(&combo->stickOptions, leftStick.x, leftStick.y, rightStick.x, rightStick.y, state.stickButtons);
+            const auto held     = buttons | state.stickButtons;
+            const bool pressed  = MatchesExpression(combo->expression, held);
+            const bool pressNew = pressed && !state.pressed;
+            const bool released = !pressed && state.pressed;
+            state.pressed       = pressed;
+            if (pressNew) {
+                state.holdStart = sampleTime;
+                state.holdFired = false;
+            }
+
+            const auto heldForInMs = static_cast<uint32_t>(OSTicksToMilliseconds(sampleTime - state.holdStart));
+            if (released) {
+                state.released    = true;
+                state.releaseTime = sampleTime;
+                Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_IDLE, sampleTime, heldForInMs);
+                continue;
+            }
+            if (IsHoldType(combo->info.type)) {
+                if (pressNew) {
+                    Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_ARMING, sampleTime, heldForInMs);
+                }
+                if (!pressed || state.holdFired || heldForInMs < combo->info.optionalHoldForXMs) {
+                    continue;
+                }
+                state.holdFired = true;
+            } else if (!pressNew) {
+                continue;
+            }
+
+            if (IsFiltered(*combo, state, sampleTime)) {
+                combo->suppressedCount++;
+                Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_SUPPRESSED, sampleTime, heldForInMs);
+                Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_HELD, sampleTime, heldForInMs);
+                continue;
+            }
+            combo->dispatched   = true;
+            combo->lastDispatch = sampleTime;
+
+            triggered++;
+            // Recorded before the callback runs, it may remove the combo.
+            Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_FIRED, sampleTime, heldForInMs);
+            Transition(*combo, index, controller, BUTTON_COMBO_MODULE_TIMELINE_STATE_HELD, sampleTime, heldForInMs);
+            if (combo->callbackEx != nullptr) {
+                const ButtonComboModule_TriggerInfo info = {.triggeredBy  = controller,
+                                                            .buttons      = held,
+                                                            .inputTime    = sampleTime,
+                                                            .dispatchTime = OSGetSystemTime(),
+                                                            .heldForInMs  = heldForInMs};
+                RunCallback([&] { combo->callbackEx(&info, ButtonComboModule_ComboHandle(combo.get()), combo->callbackOptions.context); });
+            } else if (sBatchCallback != nullptr) {
+                batch.push_back({.handle = ButtonComboModule_ComboHandle(combo.get()), .triggeredBy = controller, .callbackOptions = combo->callbackOptions});
+            } else if (sCallbacksUnlocked) {
+                // Only entered from FakeModule::InjectInput, which holds the lock exactly once.
+                const auto options = combo->callbackOptions;
+                RunCallback([&] {
+                    sMutex.unlock();
+                    options.callback(controller, ButtonComboModule_ComboHandle(combo.get()), options.context);
+                    sMutex.lock();
+                });
+            } else {
+                RunCallback([&] { combo->callbackOptions.callback(controller, ButtonComboModule_ComboHandle(combo.get()), combo->callbackOptions.context); });
+            }
+        }
+        if (!batch.empty()) {
+            RunCallback([&] { sBatchCallback(batch.data(), static_cast<uint32_t>(batch.size()), sBatchContext); });
+        }
+
+        const auto evalTime = OSGetSystemTime() - start;
+        sCounters.frames++;
+        sCounters.totalFrameEvalTime += evalTime;
+        sCounters.peakFrameEvalTime  = std::max(sCounters.peakFrameEvalTime, evalTime);
+        return triggered;
+    }
+
+    ButtonComboModule_Error InjectInput(const ButtonComboModule_InputSample *samples, const uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            const auto controller = static_cast<uint32_t>(samples[i].controller);
+            if (controller == 0 || (controller & (controller - 1)) != 0 || (controller & ~BUTTON_COMBO_MODULE_CONTROLLER_ALL) != 0) {
+                return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            Evaluate(samples[i].controller, samples[i].buttons, {}, {}, samples[i].sampleTime);
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetRealInputMask(const ButtonComboModule_ControllerTypes controllerMask) {
+        sRealInputMask = controllerMask;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetRealInputMask(ButtonComboModule_ControllerTypes *outControllerMask) {
+        *outControllerMask = static_cast<ButtonComboModule_ControllerTypes>(sRealInputMask);
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error StopTimelineRecording() {
+        if (sRecorder != nullptr) {
+            __atomic_store_n(&sRecorder->recording, 0, __ATOMIC_RELEASE);
+            sRecorder = nullptr;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error StartTimelineRecording(ButtonComboModule_TimelineRecorder *recorder) {
+        StopTimelineRecording();
+        recorder->totalCount = 0;
+        recorder->recording  = 1;
+        sRecorder            = recorder;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetVersion(ButtonComboModule_APIVersion *outVersion) {
+        *outVersion = sApiVersion;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error AddButtonCombo(const ButtonComboModule_ComboOptions *options,
+                                           ButtonComboModule_ComboHandle *outHandle,
+                                           ButtonComboModule_ComboStatus *outStatus) {
+        const bool expression = options->version == BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION;
+        const bool extended   = options->version == BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX || expression;
+        if (options->callbackOptions.callback == nullptr && (!extended || options->callbackEx == nullptr)) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (extended && options->triggerFilter.version != 0 && options->triggerFilter.version != BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION) {
+            return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+        }
+        const auto &info = options->buttonComboOptions;
+        if ((expression ? !IsValidExpression(options->expression) : info.basicCombo.combo == 0) || info.basicCombo.controllerMask == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO;
+        }
+        if (info.type < BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD || info.type > BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO_TYPE;
+        }
+        if (IsHoldType(info.type) && info.optionalHoldForXMs == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_DURATION_MISSING;
+        }
+
+        auto combo             = std::make_unique<Combo>();
+        combo->label           = options->metaOptions.label != nullptr ? options->metaOptions.label : "";
+        combo->callbackOptions = options->callbackOptions;
+        combo->callbackEx      = extended ? options->callbackEx : nullptr;
+        combo->info            = info;
+        combo->expression      = expression ? options->expression : ButtonComboModule_ComboExpression{.required = info.basicCombo.combo};
+        if (extended && options->triggerFilter.version != 0) {
+            combo->filter = options->triggerFilter;
+        }
+        *outHandle             = ButtonComboModule_ComboHandle(combo.get());
+        UpdateConflict(*combo);
+        if (outStatus != nullptr) {
+            *outStatus = GetStatus(*combo);
+        }
+        sCombos.push_back(std::move(combo));
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error RemoveButtonCombo(const ButtonComboModule_ComboHandle handle) {
+        std::erase_if(sCombos, [handle](const auto &combo) { return combo.get() == handle.handle; });
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error RemoveButtonCombos(const ButtonComboModule_ComboHandle *handles, const uint32_t count) {
+        std::erase_if(sCombos, [handles, count](const auto &combo) {
+            return std::any_of(handles, handles + count, [&combo](const auto handle) { return combo.get() == handle.handle; });
+        });
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboStatus(const ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboStatus *outStatus) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_HANDLE_NOT_FOUND;
+        }
+        *outStatus = GetStatus(*combo);
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateButtonComboMeta(const ButtonComboModule_ComboHandle handle, const ButtonComboModule_MetaOptions *options) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->label = options->label != nullptr ? options->label : "";
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateButtonComboCallback(const ButtonComboModule_ComboHandle handle, const ButtonComboModule_CallbackOptions *options) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || options->callback == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->callbackOptions = *options;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateControllerMask(const ButtonComboModule_ComboHandle handle,
+                                                 const ButtonComboModule_ControllerTypes controllerMask,
+                                                 ButtonComboModule_ComboStatus *outStatus) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || controllerMask == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->info.basicCombo.controllerMask = controllerMask;
+        UpdateConflict(*combo);
+        if (outStatus != nullptr) {
+            *outStatus = GetStatus(*combo);
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateButtonCombo(const ButtonComboModule_ComboHandle handle,
+                                              const ButtonComboModule_Buttons buttons,
+                                              ButtonComboModule_ComboStatus *outStatus) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || buttons == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->info.basicCombo.combo = buttons;
+        combo->expression            = {.required = buttons};
+        UpdateConflict(*combo);
+        if (outStatus != nullptr) {
+            *outStatus = GetStatus(*combo);
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateHoldDuration(const ButtonComboModule_ComboHandle handle, const uint32_t holdDurationInMs) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || !IsHoldType(combo->info.type) || holdDurationInMs == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->info.optionalHoldForXMs = holdDurationInMs;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboMeta(const ButtonComboModule_ComboHandle handle, ButtonComboModule_MetaOptionsOut *outOptions) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr || outOptions->labelBuffer == nullptr || outOptions->labelBufferLength == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        const auto length = std::min<size_t>(combo->label.size(), outOptions->labelBufferLength - 1);
+        memcpy(outOptions->labelBuffer, combo->label.data(), length);
+        outOptions->labelBuffer[length] = '\0';
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboLabel(const ButtonComboModule_ComboHandle handle, const char **outLabel, uint32_t *outLength) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outLabel  = combo->label.c_str();
+        *outLength = static_cast<uint32_t>(combo->label.size());
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboCallback(const ButtonComboModule_ComboHandle handle, ButtonComboModule_CallbackOptions *outOptions) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outOptions = combo->callbackOptions;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboCallbackEx(const ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboCallbackEx *outCallbackEx) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outCallbackEx = combo->callbackEx;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetButtonComboInfoEx(const ButtonComboModule_ComboHandle handle, ButtonComboModule_ButtonComboInfoEx *outOptions) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outOptions = combo->info;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateTriggerFilter(const ButtonComboModule_ComboHandle handle, const uint32_t cooldownInMs, const uint32_t debounceInMs) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->filter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION, .cooldownInMs = cooldownInMs, .debounceInMs = debounceInMs};
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetSuppressedTriggerCount(const ButtonComboModule_ComboHandle handle, uint32_t *outCount) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outCount = combo->suppressedCount;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetTriggerFilter(const ButtonComboModule_ComboHandle handle, ButtonComboModule_TriggerFilter *outFilter) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (outFilter->version != BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION) {
+            return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+        }
+        *outFilter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION, .cooldownInMs = combo->filter.cooldownInMs, .debounceInMs = combo->filter.debounceInMs};
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateComboExpression(const ButtonComboModule_ComboHandle handle,
+                                                  const ButtonComboModule_ComboExpression *expression,
+                                                  ButtonComboModule_ComboStatus *outStatus) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || !IsValidExpression(*expression)) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->expression = *expression;
+        UpdateConflict(*combo);
+        if (outStatus != nullptr) {
+            *outStatus = GetStatus(*combo);
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetComboExpression(const ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboExpression *outExpression) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outExpression = combo->expression;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error UpdateStickDirectionOptions(const ButtonComboModule_ComboHandle handle, const ButtonComboModule_StickDirectionOptions *options) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->stickOptions = *options;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetControllerStates(const ButtonComboModule_ControllerTypes controllerMask,
+                                                ButtonComboModule_ControllerState *outStates,
+                                                const uint32_t maxCount,
+                                                uint32_t *outCount) {
+        *outCount = 0;
+        for (uint32_t i = 0; i < CONTROLLER_COUNT; i++) {
+            const auto controller = static_cast<ButtonComboModule_ControllerTypes>(1 << i);
+            if ((controllerMask & controller) == 0) {
+                continue;
+            }
+            if (*outCount == maxCount) {
+                return BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL;
+            }
+            auto &state      = outStates[(*outCount)++];
+            state            = sControllerStates[i];
+            state.controller = controller;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error CreateComboGroup(ButtonComboModule_ComboGroupHandle *outGroup) {
+        sGroups.push_back(std::make_unique<Group>());
+        *outGroup = ButtonComboModule_ComboGroupHandle(sGroups.back().get());
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error DestroyComboGroup(const ButtonComboModule_ComboGroupHandle handle) {
+        for (const auto &combo : sCombos) {
+            if (combo->group == handle.handle) {
+                combo->group = nullptr;
+            }
+        }
+        std::erase_if(sGroups, [handle](const auto &group) { return group.get() == handle.handle; });
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error AddToComboGroup(const ButtonComboModule_ComboGroupHandle group, const ButtonComboModule_ComboHandle handle) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr || FindGroup(group) == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->group = FindGroup(group);
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error RemoveFromComboGroup(const ButtonComboModule_ComboGroupHandle group, const ButtonComboModule_ComboHandle handle) {
+        if (FindGroup(group) == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (auto *combo = FindCombo(handle); combo != nullptr && combo->group == group.handle) {
+            combo->group = nullptr;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetComboGroupEnabled(const ButtonComboModule_ComboGroupHandle handle, const bool enabled) {
+        auto *group = FindGroup(handle);
+        if (group == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (group->enabled == enabled) {
+            return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+        }
+        group->enabled = enabled;
+        if (enabled) {
+            // Re-checked in order of registration, so members of the group may block each other.
+            for (const auto &combo : sCombos) {
+                if (combo->group == group) {
+                    combo->conflict = true;
+                }
+            }
+            for (const auto &combo : sCombos) {
+                if (combo->group == group) {
+                    UpdateConflict(*combo);
+                }
+            }
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetClientSuspended(const bool suspended) {
+        sClientSuspended = suspended;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetButtonComboSuspendExempt(const ButtonComboModule_ComboHandle handle, const bool exempt) {
+        auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        combo->suspendExempt = exempt;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error CheckComboAvailable(const ButtonComboModule_ButtonComboOptions *options, ButtonComboModule_ComboStatus *outStatus) {
+        if (options->combo == 0 || options->controllerMask == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        *outStatus = HasConflict({.required = options->combo}, options->controllerMask, nullptr) ? BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT : BUTTON_COMBO_MODULE_COMBO_STATUS_VALID;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetComboConflicts(const ButtonComboModule_ButtonComboOptions *options,
+                                              ButtonComboModule_ConflictInfo *outConflicts,
+                                              const uint32_t maxCount,
+                                              uint32_t *outCount) {
+        if (options->combo == 0 || options->controllerMask == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        return ListConflicts({.required = options->combo}, options->controllerMask, nullptr, outConflicts, maxCount, outCount);
+    }
+
+    ButtonComboModule_Error GetButtonComboConflicts(const ButtonComboModule_ComboHandle handle,
+                                                    ButtonComboModule_ConflictInfo *outConflicts,
+                                                    const uint32_t maxCount,
+                                                    uint32_t *outCount) {
+        const auto *combo = FindCombo(handle);
+        if (combo == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (!combo->conflict) {
+            *outCount = 0;
+            return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+        }
+        return ListConflicts(combo->expression, combo->info.basicCombo.controllerMask, combo, outConflicts, maxCount, outCount);
+    }
+
+    ButtonComboModule_Error SuggestFreeCombos(const ButtonComboModule_SuggestComboOptions *options,
+                                              ButtonComboModule_Buttons *outCombos,
+                                              const uint32_t maxCount,
+                                              uint32_t *outCount) {
+        if (options->controllerMask == 0 || options->allowedButtons == 0 || options->maxChordSize == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        std::vector<uint32_t> buttons;
+        for (uint32_t bit = 0; bit < 32; bit++) {
+            if ((options->allowedButtons & (1u << bit)) != 0) {
+                buttons.push_back(1u << bit);
+            }
+        }
+        *outCount               = 0;
+        const auto maxChordSize = std::min<size_t>(options->maxChordSize, buttons.size());
+        // Every chord size is enumerated as ascending indices into buttons, smaller chords first.
+        std::vector<size_t> indices;
+        for (size_t size = 1; size <= maxChordSize && *outCount < maxCount; size++) {
+            indices.resize(size);
+            for (size_t i = 0; i < size; i++) {
+                indices[i] = i;
+            }
+            while (*outCount < maxCount) {
+                uint32_t combo = 0;
+                for (const auto index : indices) {
+                    combo |= buttons[index];
+                }
+                if (!HasConflict({.required = static_cast<ButtonComboModule_Buttons>(combo)}, options->controllerMask, nullptr)) {
+                    outCombos[(*outCount)++] = static_cast<ButtonComboModule_Buttons>(combo);
+                }
+                size_t i = size;
+                while (i > 0 && indices[i - 1] == buttons.size() - size + i - 1) {
+                    i--;
+                }
+                if (i == 0) {
+                    break;
+                }
+                indices[i - 1]++;
+                for (size_t j = i; j < size; j++) {
+                    indices[j] = indices[j - 1] + 1;
+                }
+            }
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    // The fake has a single client, which owns every combo.
+    constexpr char SNAPSHOT_OWNER[] = "FakeClient";
+
+    ButtonComboModule_Error GetComboSnapshot(void *buffer, const uint32_t bufferSize, uint32_t *outRequiredSize) {
+        const uint32_t entriesOffset = sizeof(ButtonComboModule_SnapshotHeader);
+        const uint32_t poolOffset    = entriesOffset + sCombos.size() * sizeof(ButtonComboModule_SnapshotEntry);
+        // The owner name is shared by all entries and followed by the labels.
+        uint32_t poolSize = sizeof(SNAPSHOT_OWNER);
+        for (const auto &combo : sCombos) {
+            poolSize += combo->label.size() + 1;
+        }
+        *outRequiredSize = poolOffset + poolSize;
+        if (bufferSize < *outRequiredSize) {
+            return BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL;
+        }
+
+        auto *data = static_cast<uint8_t *>(buffer);
+        *reinterpret_cast<ButtonComboModule_SnapshotHeader *>(data) = {.version          = BUTTON_COMBO_MODULE_SNAPSHOT_VERSION,
+                                                                       .headerSize       = entriesOffset,
+                                                                       .entrySize        = sizeof(ButtonComboModule_SnapshotEntry),
+                                                                       .entryCount       = static_cast<uint32_t>(sCombos.size()),
+                                                                       .stringPoolOffset = poolOffset,
+                                                                       .stringPoolSize   = poolSize};
+        memcpy(data + poolOffset, SNAPSHOT_OWNER, sizeof(SNAPSHOT_OWNER));
+        auto *entry          = reinterpret_cast<ButtonComboModule_SnapshotEntry *>(data + entriesOffset);
+        uint32_t labelOffset = sizeof(SNAPSHOT_OWNER);
+        for (const auto &combo : sCombos) {
+            *entry++ = {.handle           = ButtonComboModule_ComboHandle(combo.get()),
+                        .ownerOffset      = 0,
+                        .type             = combo->info.type,
+                        .controllerMask   = combo->info.basicCombo.controllerMask,
+                        .combo            = combo->info.basicCombo.combo,
+                        .holdDurationInMs = IsHoldType(combo->info.type) ? combo->info.optionalHoldForXMs : 0,
+                        .status           = GetStatus(*combo),
+                        .labelOffset      = labelOffset};
+            memcpy(data + poolOffset + labelOffset, combo->label.c_str(), combo->label.size() + 1);
+            labelOffset += combo->label.size() + 1;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error DetectButtonComboBlocking(const ButtonComboModule_DetectButtonComboOptions *, ButtonComboModule_Buttons *) {
+        // There is no input thread that could ever complete the detection.
+        return BUTTON_COMBO_MODULE_ERROR_ABORTED;
+    }
+
+    ButtonComboModule_Error DetectButtonComboAsync(const ButtonComboModule_DetectButtonComboOptions *options,
+                                                   const ButtonComboModule_DetectButtonComboCallback callback,
+                                                   void *context) {
+        if (options->controllerMask == 0 || options->holdComboForInMs == 0) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        if (sDetection.active) {
+            // The fake only runs one detection at a time.
+            return BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR;
+        }
+        sDetection = {.active = true, .options = *options, .callback = callback, .context = context, .buttons = {}, .heldSince = {}};
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetBatchCallback(const ButtonComboModule_BatchCallback callback, void *context) {
+        sBatchCallback = callback;
+        sBatchContext  = context;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error GetStats(ButtonComboModule_Stats *outStats) {
+        *outStats = {.version = BUTTON_COMBO_MODULE_STATS_VERSION};
+        for (const auto &combo : sCombos) {
+            outStats->combosByType[combo->info.type]++;
+            for (uint32_t i = 0; i < BUTTON_COMBO_MODULE_CONTROLLER_COUNT; i++) {
+                if ((combo->info.basicCombo.controllerMask & (1u << i)) != 0) {
+                    outStats->combosByController[i]++;
+                }
+            }
+            outStats->comboMemoryInBytes += sizeof(Combo);
+            outStats->labelMemoryInBytes += combo->label.size() + 1;
+        }
+        if (sCounters.frames != 0) {
+            outStats->avgFrameEvalTimeInUs = static_cast<uint32_t>(OSTicksToMicroseconds(sCounters.totalFrameEvalTime / static_cast<OSTime>(sCounters.frames)));
+        }
+        outStats->peakFrameEvalTimeInUs = static_cast<uint32_t>(OSTicksToMicroseconds(sCounters.peakFrameEvalTime));
+        outStats->callbacksDispatched   = sCounters.callbacksDispatched;
+        outStats->callbacksOverBudget   = sCounters.callbacksOverBudget;
+        outStats->callbackBudgetInUs    = sCounters.callbackBudgetInUs;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ButtonComboModule_Error SetCallbackBudget(const uint32_t budgetInUs) {
+        sCounters.callbackBudgetInUs = budgetInUs;
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    template <auto Function>
+    struct Locked;
+
+    template <typename... Args, ButtonComboModule_Error (*Function)(Args...)>
+    struct Locked<Function> {
+        static ButtonComboModule_Error Call(Args... args) {
+            std::lock_guard lock(sMutex);
+            return Function(args...);
+        }
+    };
+
+    struct Export {
+        const char *name;
+        void *address;
+    };
+
+    const Export sExports[] = {
+            {"GetVersion", reinterpret_cast<void *>(Locked<GetVersion>::Call)},
+            {"ButtonComboModule_GetVersion", reinterpret_cast<void *>(Locked<GetVersion>::Call)},
+            {"ButtonComboModule_AddButtonCombo", reinterpret_cast<void *>(Locked<AddButtonCombo>::Call)},
+            {"ButtonComboModule_RemoveButtonCombo", reinterpret_cast<void *>(Locked<RemoveButtonCombo>::Call)},
+            {"ButtonComboModule_RemoveButtonCombos", reinterpret_cast<void *>(Locked<RemoveButtonCombos>::Call)},
+            {"ButtonComboModule_GetButtonComboStatus", reinterpret_cast<void *>(Locked<GetButtonComboStatus>::Call)},
+            {"ButtonComboModule_UpdateButtonComboMeta", reinterpret_cast<void *>(Locked<UpdateButtonComboMeta>::Call)},
+            {"ButtonComboModule_UpdateButtonComboCallback", reinterpret_cast<void *>(Locked<UpdateButtonComboCallback>::Call)},
+            {"ButtonComboModule_UpdateControllerMask", reinterpret_cast<void *>(Locked<UpdateControllerMask>::Call)},
+            {"ButtonComboModule_UpdateButtonCombo", reinterpret_cast<void *>(Locked<UpdateButtonCombo>::Call)},
+            {"ButtonComboModule_UpdateHoldDuration", reinterpret_cast<void *>(Locked<UpdateHoldDuration>::Call)},
+            {"ButtonComboModule_GetButtonComboMeta", reinterpret_cast<void *>(Locked<GetButtonComboMeta>::Call)},
+            {"ButtonComboModule_GetButtonComboCallback", reinterpret_cast<void *>(Locked<GetButtonComboCallback>::Call)},
+            {"ButtonComboModule_GetButtonComboInfoEx", reinterpret_cast<void *>(Locked<GetButtonComboInfoEx>::Call)},
+            {"ButtonComboModule_UpdateTriggerFilter", reinterpret_cast<void *>(Locked<UpdateTriggerFilter>::Call)},
+            {"ButtonComboModule_GetSuppressedTriggerCount", reinterpret_cast<void *>(Locked<GetSuppressedTriggerCount>::Call)},
+            {"ButtonComboModule_GetTriggerFilter", reinterpret_cast<void *>(Locked<GetTriggerFilter>::Call)},
+            {"ButtonComboModule_CheckComboAvailable", reinterpret_cast<void *>(Locked<CheckComboAvailable>::Call)},
+            {"ButtonComboModule_DetectButtonCombo_Blocking", reinterpret_cast<void *>(Locked<DetectButtonComboBlocking>::Call)},
+            {"ButtonComboModule_DetectButtonCombo_Async", reinterpret_cast<void *>(Locked<DetectButtonComboAsync>::Call)},
+            {"ButtonComboModule_SetBatchCallback", reinterpret_cast<void *>(Locked<SetBatchCallback>::Call)},
+            {"ButtonComboModule_UpdateComboExpression", reinterpret_cast<void *>(Locked<UpdateComboExpression>::Call)},
+            {"ButtonComboModule_GetComboExpression", reinterpret_cast<void *>(Locked<GetComboExpression>::Call)},
+            {"ButtonComboModule_GetButtonComboLabel", reinterpret_cast<void *>(Locked<GetButtonComboLabel>::Call)},
+            {"ButtonComboModule_UpdateStickDirectionOptions", reinterpret_cast<void *>(Locked<UpdateStickDirectionOptions>::Call)},
+            {"ButtonComboModule_GetControllerStates", reinterpret_cast<void *>(Locked<GetControllerStates>::Call)},
+            {"ButtonComboModule_CreateComboGroup", reinterpret_cast<void *>(Locked<CreateComboGroup>::Call)},
+            {"ButtonComboModule_DestroyComboGroup", reinterpret_cast<void *>(Locked<DestroyComboGroup>::Call)},
+            {"ButtonComboModule_AddToComboGroup", reinterpret_cast<void *>(Locked<AddToComboGroup>::Call)},
+            {"ButtonComboModule_RemoveFromComboGroup", reinterpret_cast<void *>(Locked<RemoveFromComboGroup>::Call)},
+            {"ButtonComboModule_SetComboGroupEnabled", reinterpret_cast<void *>(Locked<SetComboGroupEnabled>::Call)},
+            {"ButtonComboModule_SetClientSuspended", reinterpret_cast<void *>(Locked<SetClientSuspended>::Call)},
+            {"ButtonComboModule_SetButtonComboSuspendExempt", reinterpret_cast<void *>(Locked<SetButtonComboSuspendExempt>::Call)},
+            {"ButtonComboModule_InjectInput", reinterpret_cast<void *>(Locked<InjectInput>::Call)},
+            {"ButtonComboModule_SetRealInputMask", reinterpret_cast<void *>(Locked<SetRealInputMask>::Call)},
+            {"ButtonComboModule_GetRealInputMask", reinterpret_cast<void *>(Locked<GetRealInputMask>::Call)},
+            {"ButtonComboModule_StartTimelineRecording", reinterpret_cast<void *>(Locked<StartTimelineRecording>::Call)},
+            {"ButtonComboModule_StopTimelineRecording", reinterpret_cast<void *>(Locked<StopTimelineRecording>::Call)},
+            {"ButtonComboModule_GetButtonComboCallbackEx", reinterpret_cast<void *>(Locked<GetButtonComboCallbackEx>::Call)},
+            {"ButtonComboModule_GetComboConflicts", reinterpret_cast<void *>(Locked<GetComboConflicts>::Call)},
+            {"ButtonComboModule_GetButtonComboConflicts", reinterpret_cast<void *>(Locked<GetButtonComboConflicts>::Call)},
+            {"ButtonComboModule_SuggestFreeCombos", reinterpret_cast<void *>(Locked<SuggestFreeCombos>::Call)},
+            {"ButtonComboModule_GetComboSnapshot", reinterpret_cast<void *>(Locked<GetComboSnapshot>::Call)},
+            {"ButtonComboModule_GetStats", reinterpret_cast<void *>(Locked<GetStats>::Call)},
+            {"ButtonComboModule_SetCallbackBudget", reinterpret_cast<void *>(Locked<SetCallbackBudget>::Call)},
+    };
+} // namespace
+
+namespace FakeModule {
+    uint32_t InjectInput(const ButtonComboModule_ControllerTypes controller, const ButtonComboModule_Buttons buttons, const OSTime sampleTime) {
+        return InjectInput(controller, buttons, {}, {}, sampleTime);
+    }
+
+    uint32_t InjectInput(const ButtonComboModule_ControllerTypes controller,
+                         const ButtonComboModule_Buttons buttons,
+                         const StickPosition leftStick,
+                         const StickPosition rightStick,
+                         const OSTime sampleTime) {
+        std::lock_guard lock(sMutex);
+        if ((sRealInputMask & controller) != 0) {
+            return 0;
+        }
+        return Evaluate(controller, buttons, leftStick, rightStick, sampleTime);
+    }
+
+    OSTime NextSampleTime() {
+        return sSampleTime += OSMillisecondsToTicks(16);
+    }
+
+    uint32_t Press(const ButtonComboModule_Buttons buttons, const StickPosition leftStick, const ButtonComboModule_ControllerTypes controller) {
+        const auto triggered = InjectInput(controller, buttons, leftStick, {}, NextSampleTime());
+        InjectInput(controller, static_cast<ButtonComboModule_Buttons>(0), NextSampleTime());
+        return triggered;
+    }
+
+    void SetApiVersion(const ButtonComboModule_APIVersion version) {
+        std::lock_guard lock(sMutex);
+        sApiVersion = version;
+    }
+
+    void SetMissingExport(const char *name) {
+        std::lock_guard lock(sMutex);
+        sMissingExport = name != nullptr ? name : "";
+    }
+
+    void SetCallbacksUnlocked(const bool unlocked) {
+        std::lock_guard lock(sMutex);
+        sCallbacksUnlocked = unlocked;
+    }
+
+    uint32_t GetComboCount() {
+        std::lock_guard lock(sMutex);
+        return static_cast<uint32_t>(sCombos.size());
+    }
+
+    int32_t GetAcquireCount() {
+        return sAcquireCount.load();
+    }
+
+    void SetForeground(const bool foreground) {
+        std::lock_guard lock(sMutex);
+        const auto type = foreground ? PROCUI_CALLBACK_ACQUIRE : PROCUI_CALLBACK_RELEASE;
+        if (sForegroundCallbacks[type] != nullptr) {
+            sForegroundCallbacks[type](sForegroundCallbackParams[type]);
+        }
+    }
+} // namespace FakeModule
+
+extern "C" {
+OSDynLoad_Error OSDynLoad_Acquire(const char *name, OSDynLoad_Module *outModule) {
+    if (strcmp(name, "homebrew_buttoncombo") != 0) {
+        return OS_DYNLOAD_INVALID_MODULE_NAME;
+    }
+    sAcquireCount++;
+    *outModule = reinterpret_cast<OSDynLoad_Module>(&sAcquireCount);
+    return OS_DYNLOAD_OK;
+}
+
+OSDynLoad_Error OSDynLoad_FindExport(OSDynLoad_Module, OSDynLoad_ExportType, const char *name, void **outAddr) {
+    std::lock_guard lock(sMutex);
+    for (const auto &entry : sExports) {
+        if (strcmp(entry.name, name) == 0 && sMissingExport != name) {
+            *outAddr = entry.address;
+            return OS_DYNLOAD_OK;
+        }
+    }
+    return OS_DYNLOAD_INVALID_MODULE_NAME;
+}
+
+void OSDynLoad_Release(OSDynLoad_Module) {
+    sAcquireCount--;
+}
+
+OSTime OSGetSystemTime() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void OSYieldThread() {
+    std::this_thread::yield();
+}
+
+void ProcUIRegisterCallback(const ProcUICallbackType type, const ProcUICallback callback, void *param, uint32_t) {
+    std::lock_guard lock(sMutex);
+    if (type == PROCUI_CALLBACK_ACQUIRE || type == PROCUI_CALLBACK_RELEASE) {
+        sForegroundCallbacks[type]      = callback;
+        sForegroundCallbackParams[type] = param;
+    }
+}
+}
\ No newline at end of file
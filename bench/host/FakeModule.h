@@ -0,0 +1,103 @@
+#pragma once
+
+#include <buttoncombo/defines.h>
+
+#include <coreinit/time.h>
+
+#include <cstdint>
+
+/**
+ * @file FakeModule.h
+ * @brief Host-side fake of the ButtonComboModule.
+ *
+ * Provides the OSDynLoad functions libbuttoncombo resolves the module exports with, and a minimal implementation of
+ * the combo evaluation. All exports and functions below are serialized by one lock, callbacks run with the lock held
+ * unless @ref SetCallbacksUnlocked is set.
+ * Non-observer combos conflict if every button state that triggers one of them also triggers the other one, a combo
+ * that conflicts with a VALID combo on a shared controller gets the status CONFLICT when it's added or updated.
+ * All combos belong to the same client, @ref ButtonComboModule_SetClientSuspended suspends all of them.
+ * Triggers filtered out by the cooldown or debounce time of a combo are counted, but run no callback and are not
+ * included in the returned number of triggered combos.
+ * One @ref ButtonComboModule_DetectButtonCombo_Async detection can run at a time, it completes once the buttons of a
+ * controller have been held unchanged for the requested duration.
+ * Every sample is one input frame of its controller, a batch callback receives the plain triggers of one sample at once.
+ */
+namespace FakeModule {
+
+    /**
+     * @brief Feeds a real button state sample of a single controller into the fake module.
+     *
+     * Evaluates all registered combos for this controller and calls the callbacks of the triggered combos on the
+     * calling thread. Ignored for controllers that are masked via @ref ButtonComboModule_SetRealInputMask,
+     * @ref ButtonComboModule_InjectInput is evaluated the same way.
+     *
+     * @param controller  Exactly one controller, e.g. BUTTON_COMBO_MODULE_CONTROLLER_WPAD_3.
+     * @param buttons     All buttons that are currently held on the controller.
+     * @param sampleTime  The time the sample has been read.
+     * @return Number of triggered combos.
+     */
+    uint32_t InjectInput(ButtonComboModule_ControllerTypes controller, ButtonComboModule_Buttons buttons, OSTime sampleTime);
+
+    struct StickPosition {
+        float x; // -1.0 (left) to 1.0 (right)
+        float y; // -1.0 (down) to 1.0 (up)
+    };
+
+    /**
+     * @brief Same as @ref InjectInput, but also feeds the stick positions of the controller.
+     *
+     * The stick directions are derived per combo, using the thresholds set via
+     * @ref ButtonComboModule_UpdateStickDirectionOptions.
+     */
+    uint32_t InjectInput(ButtonComboModule_ControllerTypes controller,
+                         ButtonComboModule_Buttons buttons,
+                         StickPosition leftStick,
+                         StickPosition rightStick,
+                         OSTime sampleTime);
+
+    /**
+     * @brief Returns the time for the next sample of a test, 16 ms after the previous one.
+     */
+    OSTime NextSampleTime();
+
+    /**
+     * @brief Presses the buttons and releases them with the next sample, both at @ref NextSampleTime.
+     *
+     * @return Number of combos triggered by the press.
+     */
+    uint32_t Press(ButtonComboModule_Buttons buttons,
+                   StickPosition leftStick                      = {},
+                   ButtonComboModule_ControllerTypes controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+
+    /**
+     * @brief Sets the API version the module reports. Takes effect on the next ButtonComboModule_InitLibrary, defaults to 2.
+     */
+    void SetApiVersion(ButtonComboModule_APIVersion version);
+
+    /**
+     * @brief Hides an export from OSDynLoad_FindExport, e.g. to emulate an older module. Takes effect on the next
+     * ButtonComboModule_InitLibrary, NULL exposes all exports again.
+     */
+    void SetMissingExport(const char *name);
+
+    /**
+     * @brief Calls plain combo callbacks from @ref InjectInput without holding the lock, so other threads may update
+     * the callbacks of combos while they run. Combos must not be added or removed while this is set.
+     */
+    void SetCallbacksUnlocked(bool unlocked);
+
+    /**
+     * @brief Returns the number of currently registered combos.
+     */
+    uint32_t GetComboCount();
+
+    /**
+     * @brief Returns how often the module has been acquired but not released yet.
+     */
+    int32_t GetAcquireCount();
+
+    /**
+     * @brief Calls the ProcUI callback that has been registered for PROCUI_CALLBACK_ACQUIRE or PROCUI_CALLBACK_RELEASE.
+     */
+    void SetForeground(bool foreground);
+} // namespace FakeModule
\ No newline at end of file
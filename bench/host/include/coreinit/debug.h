@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdio.h>
+
+#define OSReport(FMT, ...) fprintf(stderr, FMT, ##__VA_ARGS__)
\ No newline at end of file
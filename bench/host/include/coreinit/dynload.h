@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef struct OSDynLoad_Module_ *OSDynLoad_Module;
+
+typedef enum OSDynLoad_Error {
+    OS_DYNLOAD_OK                  = 0,
+    OS_DYNLOAD_INVALID_MODULE_NAME = 0xBAD10002,
+} OSDynLoad_Error;
+
+typedef enum OSDynLoad_ExportType {
+    OS_DYNLOAD_EXPORT_FUNC = 0,
+    OS_DYNLOAD_EXPORT_DATA = 1,
+} OSDynLoad_ExportType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+OSDynLoad_Error OSDynLoad_Acquire(const char *name, OSDynLoad_Module *outModule);
+OSDynLoad_Error OSDynLoad_FindExport(OSDynLoad_Module module, OSDynLoad_ExportType exportType, const char *name, void **outAddr);
+void OSDynLoad_Release(OSDynLoad_Module module);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void OSYieldThread(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+// On the host, one tick is one nanosecond.
+typedef int64_t OSTime;
+typedef int32_t OSTick;
+
+#define OSTicksToMilliseconds(val) ((val) / 1000000ll)
+#define OSMillisecondsToTicks(val) ((val) * 1000000ll)
+#define OSTicksToMicroseconds(val) ((val) / 1000ll)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+OSTime OSGetSystemTime(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
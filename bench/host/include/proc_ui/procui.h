@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum ProcUICallbackType {
+    PROCUI_CALLBACK_ACQUIRE            = 0,
+    PROCUI_CALLBACK_RELEASE            = 1,
+    PROCUI_CALLBACK_EXIT               = 2,
+    PROCUI_CALLBACK_NET_IO_START       = 3,
+    PROCUI_CALLBACK_NET_IO_STOP        = 4,
+    PROCUI_CALLBACK_HOME_BUTTON_DENIED = 5,
+} ProcUICallbackType;
+
+typedef uint32_t (*ProcUICallback)(void *context);
+
+void ProcUIRegisterCallback(ProcUICallbackType type, ProcUICallback callback, void *param, uint32_t priority);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+// Minimal host replacement for wut's wut_types.h, only provides what libbuttoncombo needs.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+#define WUT_ENUM_BITMASK_TYPE(_type)                                                         \
+    extern "C++" {                                                                           \
+    static constexpr inline _type operator|(_type lhs, _type rhs) {                          \
+        return static_cast<_type>(static_cast<uint64_t>(lhs) | static_cast<uint64_t>(rhs));  \
+    }                                                                                        \
+    static constexpr inline _type operator&(_type lhs, _type rhs) {                          \
+        return static_cast<_type>(static_cast<uint64_t>(lhs) & static_cast<uint64_t>(rhs));  \
+    }                                                                                        \
+    static constexpr inline _type operator~(_type value) {                                   \
+        return static_cast<_type>(~static_cast<uint64_t>(value));                            \
+    }                                                                                        \
+    static constexpr inline _type &operator|=(_type &lhs, _type rhs) {                       \
+        return lhs = lhs | rhs;                                                              \
+    }                                                                                        \
+    static constexpr inline _type &operator&=(_type &lhs, _type rhs) {                       \
+        return lhs = lhs & rhs;                                                              \
+    }                                                                                        \
+    }
+#else
+#define WUT_ENUM_BITMASK_TYPE(_type)
+#endif
\ No newline at end of file
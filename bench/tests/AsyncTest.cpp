@@ -0,0 +1,166 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboAsync.h>
+#include <buttoncombo/api.h>
+
+#include <optional>
+
+/**
+ * NextTrigger and DetectButtonComboAsync resume their coroutine from FrameExecutor::Pump. Triggers that reach an
+ * awaiter after it has completed are ignored, and releasing a combo resumes its awaiters with ABORTED.
+ */
+
+namespace {
+    uint32_t sCallCount = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sCallCount++;
+    }
+
+    std::optional<ButtonComboModule::ButtonCombo> CreateCombo(const ButtonComboModule_Buttons buttons) {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Async", buttons, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return combo;
+    }
+
+    ButtonComboModule::Task AwaitTrigger(const ButtonComboModule::ButtonCombo &combo,
+                                         ButtonComboModule::FrameExecutor &executor,
+                                         std::optional<ButtonComboModule::TriggerResult> &outResult) {
+        outResult = co_await combo.NextTrigger(executor);
+    }
+
+    ButtonComboModule::Task AwaitDetect(const ButtonComboModule_DetectButtonComboOptions options,
+                                        ButtonComboModule::FrameExecutor &executor,
+                                        std::optional<ButtonComboModule::DetectResult> &outResult) {
+        outResult = co_await ButtonComboModule::DetectButtonComboAsync(options, executor);
+    }
+
+    void TestNextTrigger() {
+        auto combo = CreateCombo(BCMPAD_BUTTON_A);
+        if (!combo) {
+            return;
+        }
+        ButtonComboModule::FrameExecutor executor;
+        std::optional<ButtonComboModule::TriggerResult> result;
+        sCallCount = 0;
+        AwaitTrigger(*combo, executor, result);
+        CHECK(executor.Pump() == 0);
+
+        // Both triggers are swallowed, but only the first one completes the awaiter.
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        CHECK(!result.has_value());
+        CHECK(executor.Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(result.has_value() && result->triggeredBy == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(sCallCount == 0);
+        CHECK(ButtonComboModule::FrameExecutor::Main().Pump() == 0);
+
+        // The original callback is back in place.
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        CHECK(sCallCount == 1);
+        CHECK(executor.Pump() == 0);
+    }
+
+    // Replays a dispatch the module started with the redirected callback, after the awaiter has completed and a new
+    // awaiter for a different combo has taken its place.
+    void TestLateTrigger() {
+        auto first  = CreateCombo(BCMPAD_BUTTON_B);
+        auto second = CreateCombo(BCMPAD_BUTTON_X);
+        if (!first || !second) {
+            return;
+        }
+        ButtonComboModule::FrameExecutor executor;
+        std::optional<ButtonComboModule::TriggerAwaiter> awaiter(std::in_place, first->getHandle(), executor);
+        CHECK(awaiter->await_suspend(std::noop_coroutine()));
+        ButtonComboModule_CallbackOptions redirected = {};
+        CHECK_ERROR(first->GetButtonComboCallback(redirected), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(redirected.context == &*awaiter);
+        FakeModule::Press(BCMPAD_BUTTON_B);
+        CHECK(executor.Pump() == 1);
+        CHECK_ERROR(awaiter->await_resume().error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        awaiter.emplace(second->getHandle(), executor);
+        CHECK(awaiter->await_suspend(std::noop_coroutine()));
+        redirected.callback(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, first->getHandle(), redirected.context);
+        CHECK(executor.Pump() == 0);
+
+        FakeModule::Press(BCMPAD_BUTTON_X);
+        CHECK(executor.Pump() == 1);
+        CHECK_ERROR(awaiter->await_resume().error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestReleaseWhileAwaiting() {
+        auto combo = CreateCombo(BCMPAD_BUTTON_Y);
+        if (!combo) {
+            return;
+        }
+        ButtonComboModule::FrameExecutor executor;
+        std::optional<ButtonComboModule::TriggerResult> result;
+        AwaitTrigger(*combo, executor, result);
+        combo.reset();
+        CHECK(executor.Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_ABORTED);
+
+        // Deinitializing the library releases the combo as well.
+        combo = CreateCombo(BCMPAD_BUTTON_Y);
+        if (!combo) {
+            return;
+        }
+        result.reset();
+        AwaitTrigger(*combo, executor, result);
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(executor.Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_ABORTED);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestDetect() {
+        ButtonComboModule::FrameExecutor executor;
+        const ButtonComboModule_DetectButtonComboOptions options = {.controllerMask   = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0,
+                                                                    .holdComboForInMs = 100,
+                                                                    .holdAbortForInMs = 50,
+                                                                    .abortButtonCombo = BCMPAD_BUTTON_MINUS};
+        std::optional<ButtonComboModule::DetectResult> result;
+        AwaitDetect(options, executor, result);
+        const auto base = FakeModule::NextSampleTime();
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L, base);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, static_cast<ButtonComboModule_Buttons>(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R), base + OSMillisecondsToTicks(50));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, static_cast<ButtonComboModule_Buttons>(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R), base + OSMillisecondsToTicks(100));
+        CHECK(executor.Pump() == 0);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, static_cast<ButtonComboModule_Buttons>(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R), base + OSMillisecondsToTicks(150));
+        CHECK(!result.has_value());
+        CHECK(executor.Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(result.has_value() && result->buttons == (BCMPAD_BUTTON_L | BCMPAD_BUTTON_R));
+
+        // The abort combo counts on every controller.
+        result.reset();
+        AwaitDetect(options, executor, result);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, BCMPAD_BUTTON_MINUS, base + OSMillisecondsToTicks(200));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, BCMPAD_BUTTON_MINUS, base + OSMillisecondsToTicks(250));
+        CHECK(executor.Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_ABORTED);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, static_cast<ButtonComboModule_Buttons>(0), base + OSMillisecondsToTicks(300));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, static_cast<ButtonComboModule_Buttons>(0), base + OSMillisecondsToTicks(300));
+
+        // Rejected detections resume right away, without going through the executor.
+        result.reset();
+        AwaitDetect({.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0}, executor, result);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK(executor.Pump() == 0);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestNextTrigger();
+    TestLateTrigger();
+    TestReleaseWhileAwaiting();
+    TestDetect();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Async");
+}
\ No newline at end of file
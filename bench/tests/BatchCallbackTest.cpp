@@ -0,0 +1,111 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <vector>
+
+/**
+ * A batch callback receives all triggers of an input frame with a single call, ButtonComboModule_DispatchTriggerRecords
+ * fans them out to the per-combo callbacks again. Extended callbacks are never batched.
+ */
+
+namespace {
+    constexpr uint32_t COMBO_COUNT = 3;
+
+    uint32_t sCalls[COMBO_COUNT] = {};
+    uint32_t sExCalls            = 0;
+
+    struct Sink {
+        uint32_t calls = 0;
+        std::vector<ButtonComboModule_TriggerRecord> records;
+    };
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *context) {
+        (*static_cast<uint32_t *>(context))++;
+    }
+
+    void OnComboEx(const ButtonComboModule_TriggerInfo *, ButtonComboModule_ComboHandle, void *) {
+        sExCalls++;
+    }
+
+    void OnBatch(const ButtonComboModule_TriggerRecord *records, const uint32_t count, void *context) {
+        auto *sink = static_cast<Sink *>(context);
+        sink->calls++;
+        sink->records.assign(records, records + count);
+    }
+
+    uint32_t GetTotalCalls() {
+        uint32_t total = 0;
+        for (const auto calls : sCalls) {
+            total += calls;
+        }
+        return total;
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Observers don't conflict with each other, so one press triggers all of them in the same frame.
+    ButtonComboModule_ComboHandle handles[COMBO_COUNT] = {};
+    ButtonComboModule_ComboStatus status               = {};
+    for (uint32_t i = 0; i < COMBO_COUNT; i++) {
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownObserver("Batch", BCMPAD_BUTTON_A, OnCombo, &sCalls[i], &handles[i], &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+    ButtonComboModule_ComboOptions options               = {};
+    options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX;
+    options.callbackEx                                   = OnComboEx;
+    options.buttonComboOptions.type                      = BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER;
+    options.buttonComboOptions.basicCombo.combo          = BCMPAD_BUTTON_A;
+    options.buttonComboOptions.basicCombo.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_ALL;
+    ButtonComboModule_ComboHandle exHandle               = {};
+    CHECK_ERROR(ButtonComboModule_AddButtonCombo(&options, &exHandle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    Sink sink;
+    CHECK_ERROR(ButtonComboModule_SetBatchCallback(OnBatch, &sink), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == COMBO_COUNT + 1);
+    CHECK(sink.calls == 1);
+    CHECK(sink.records.size() == COMBO_COUNT);
+    for (uint32_t i = 0; i < COMBO_COUNT && i < sink.records.size(); i++) {
+        const auto &record = sink.records[i];
+        CHECK(record.handle == handles[i]);
+        CHECK(record.triggeredBy == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(record.callbackOptions.callback == OnCombo);
+        CHECK(record.callbackOptions.context == &sCalls[i]);
+    }
+    CHECK(GetTotalCalls() == 0);
+    CHECK(sExCalls == 1);
+
+    // One call per frame, frames without triggers aren't reported.
+    FakeModule::Press(BCMPAD_BUTTON_A);
+    FakeModule::Press(BCMPAD_BUTTON_A, {}, BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0);
+    FakeModule::Press(BCMPAD_BUTTON_B);
+    CHECK(sink.calls == 3);
+    CHECK(sink.records.size() == COMBO_COUNT);
+    CHECK(sink.records.empty() || sink.records[0].triggeredBy == BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0);
+    CHECK(GetTotalCalls() == 0);
+
+    CHECK_ERROR(ButtonComboModule_SetBatchCallback(ButtonComboModule_DispatchTriggerRecords, nullptr), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    FakeModule::Press(BCMPAD_BUTTON_A);
+    for (const auto calls : sCalls) {
+        CHECK(calls == 1);
+    }
+
+    CHECK_ERROR(ButtonComboModule_SetBatchCallback(nullptr, nullptr), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    FakeModule::Press(BCMPAD_BUTTON_A);
+    CHECK(GetTotalCalls() == 2 * COMBO_COUNT);
+    CHECK(sink.calls == 3);
+    CHECK(sExCalls == 5);
+
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK_ERROR(ButtonComboModule_SetBatchCallback(OnBatch, &sink), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    for (const auto handle : handles) {
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+    CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(exHandle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("BatchCallback");
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboAsync.h>
+#include <buttoncombo/ButtonComboCallbackSlot.h>
+#include <buttoncombo/ButtonComboExecutor.h>
+#include <buttoncombo/api.h>
+
+#include <optional>
+
+/**
+ * Executor bindings, callback slots and NextTrigger redirect the plain callback of a combo. Combos with an extended
+ * callback have to be rejected, and must keep calling their own callback with their own context.
+ */
+
+namespace {
+    struct Context {
+        uint32_t plainCount = 0;
+        uint32_t exCount    = 0;
+    };
+
+    void OnPlain(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *context) {
+        static_cast<Context *>(context)->plainCount++;
+    }
+
+    void OnEx(const ButtonComboModule_TriggerInfo *, ButtonComboModule_ComboHandle, void *context) {
+        static_cast<Context *>(context)->exCount++;
+    }
+
+    std::optional<ButtonComboModule::ButtonCombo> CreateCombo(const ButtonComboModule_Buttons buttons,
+                                                              const ButtonComboModule_ComboCallback callback,
+                                                              const ButtonComboModule_ComboCallbackEx callbackEx,
+                                                              Context &context) {
+        ButtonComboModule_ComboOptions options               = {};
+        options.version                                      = callbackEx != nullptr ? BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX : BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
+        options.metaOptions.label                            = "CallbackEx";
+        options.callbackOptions                              = {.callback = callback, .context = &context};
+        options.callbackEx                                   = callbackEx;
+        options.buttonComboOptions.type                      = BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+        options.buttonComboOptions.basicCombo.combo          = buttons;
+        options.buttonComboOptions.basicCombo.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0;
+
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboEx(options, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return combo;
+    }
+
+    // The original callback and context must still be in place and be called on a trigger.
+    void CheckUntouched(const ButtonComboModule::ButtonCombo &combo, const ButtonComboModule_Buttons buttons, Context &context, const bool hasPlainCallback) {
+        ButtonComboModule_CallbackOptions options = {};
+        CHECK_ERROR(ButtonComboModule_GetButtonComboCallback(combo.getHandle(), &options), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(options.callback == (hasPlainCallback ? OnPlain : nullptr));
+        CHECK(options.context == &context);
+
+        context = {};
+        FakeModule::Press(buttons);
+        CHECK(context.exCount == 1);
+        CHECK(context.plainCount == 0);
+    }
+
+    void TestExecutorBinding(const bool hasPlainCallback) {
+        Context context;
+        auto combo = CreateCombo(BCMPAD_BUTTON_A, hasPlainCallback ? OnPlain : nullptr, OnEx, context);
+        if (!combo) {
+            return;
+        }
+        ButtonComboModule::QueueExecutor<> executor;
+        {
+            ButtonComboModule::ExecutorBinding binding(*combo, executor);
+            CHECK_ERROR(binding.GetError(), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+            CheckUntouched(*combo, BCMPAD_BUTTON_A, context, hasPlainCallback);
+            CHECK(executor.Drain() == 0);
+        }
+        CheckUntouched(*combo, BCMPAD_BUTTON_A, context, hasPlainCallback);
+    }
+
+    void TestCallbackSlot(const bool hasPlainCallback) {
+        Context context;
+        auto combo = CreateCombo(BCMPAD_BUTTON_B, hasPlainCallback ? OnPlain : nullptr, OnEx, context);
+        if (!combo) {
+            return;
+        }
+        {
+            ButtonComboModule::CallbackSlot slot(*combo);
+            CHECK_ERROR(slot.GetError(), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+            CheckUntouched(*combo, BCMPAD_BUTTON_B, context, hasPlainCallback);
+        }
+        CheckUntouched(*combo, BCMPAD_BUTTON_B, context, hasPlainCallback);
+    }
+
+    ButtonComboModule::Task AwaitTrigger(const ButtonComboModule::ButtonCombo &combo, std::optional<ButtonComboModule::TriggerResult> &outResult) {
+        outResult = co_await combo.NextTrigger();
+    }
+
+    void TestNextTrigger(const bool hasPlainCallback) {
+        Context context;
+        auto combo = CreateCombo(BCMPAD_BUTTON_X, hasPlainCallback ? OnPlain : nullptr, OnEx, context);
+        if (!combo) {
+            return;
+        }
+        std::optional<ButtonComboModule::TriggerResult> result;
+        AwaitTrigger(*combo, result);
+        // Rejected combos resume right away, without going through the executor.
+        CHECK(result.has_value());
+        if (result) {
+            CHECK_ERROR(result->error, BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        }
+        CheckUntouched(*combo, BCMPAD_BUTTON_X, context, hasPlainCallback);
+        CHECK(ButtonComboModule::FrameExecutor::Main().Pump() == 0);
+    }
+
+    // Plain combos are still redirected.
+    void TestPlainCombo() {
+        Context context;
+        ButtonComboModule::QueueExecutor<> executor;
+        std::optional<ButtonComboModule::ExecutorBinding> binding;
+        std::optional<ButtonComboModule::CallbackSlot> slot;
+        auto combo = CreateCombo(BCMPAD_BUTTON_Y, OnPlain, nullptr, context);
+        if (!combo) {
+            return;
+        }
+
+        binding.emplace(*combo, executor);
+        CHECK_ERROR(binding->GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::Press(BCMPAD_BUTTON_Y);
+        CHECK(context.plainCount == 0);
+        CHECK(executor.Drain() == 1);
+        CHECK(context.plainCount == 1);
+        CHECK_ERROR(binding->Unbind(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        slot.emplace(*combo);
+        CHECK_ERROR(slot->GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::Press(BCMPAD_BUTTON_Y);
+        CHECK(context.plainCount == 2);
+        CHECK_ERROR(slot->Uninstall(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(slot->Swap(OnPlain, &context), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        std::optional<ButtonComboModule::TriggerResult> result;
+        AwaitTrigger(*combo, result);
+        CHECK(!result.has_value());
+        FakeModule::Press(BCMPAD_BUTTON_Y);
+        CHECK(ButtonComboModule::FrameExecutor::Main().Pump() == 1);
+        CHECK(result.has_value() && result->error == BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(context.plainCount == 2);
+        FakeModule::Press(BCMPAD_BUTTON_Y);
+        CHECK(context.plainCount == 3);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    for (const bool hasPlainCallback : {true, false}) {
+        TestExecutorBinding(hasPlainCallback);
+        TestCallbackSlot(hasPlainCallback);
+        TestNextTrigger(hasPlainCallback);
+    }
+    TestPlainCombo();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("CallbackEx");
+}
\ No newline at end of file
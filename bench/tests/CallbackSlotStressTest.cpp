@@ -0,0 +1,110 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboCallbackSlot.h>
+#include <buttoncombo/api.h>
+
+#include <atomic>
+#include <optional>
+#include <thread>
+
+/**
+ * Swaps the callback of a combo over and over while two input threads keep triggering it. A context is retired as soon
+ * as SwapCallback has returned it, no trigger may use it afterwards.
+ */
+
+namespace {
+    constexpr uint32_t SWAP_COUNT    = 20000;
+    constexpr uint32_t CONTEXT_COUNT = 4;
+
+    struct Context {
+        std::atomic<bool> alive     = false;
+        std::atomic<uint32_t> calls = 0;
+    };
+
+    Context sContexts[CONTEXT_COUNT];
+    std::atomic<bool> sRunning        = true;
+    std::atomic<uint32_t> sViolations = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *context) {
+        auto *ctx = static_cast<Context *>(context);
+        if (!ctx->alive) {
+            sViolations++;
+        }
+        // Widens the window in which a swap can overlap this call.
+        std::this_thread::yield();
+        if (!ctx->alive) {
+            sViolations++;
+        }
+        ctx->calls++;
+    }
+
+    void InputThread(const ButtonComboModule_ControllerTypes controller) {
+        while (sRunning) {
+            FakeModule::Press(BCMPAD_BUTTON_A, {}, controller);
+        }
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    ButtonComboModule_ComboOptions options               = {};
+    options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
+    options.metaOptions.label                            = "CallbackSlotStress";
+    options.callbackOptions                              = {.callback = OnCombo, .context = &sContexts[0]};
+    options.buttonComboOptions.type                      = BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+    options.buttonComboOptions.basicCombo.combo          = BCMPAD_BUTTON_A;
+    options.buttonComboOptions.basicCombo.controllerMask = static_cast<ButtonComboModule_ControllerTypes>(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0);
+    sContexts[0].alive                                   = true;
+
+    ButtonComboModule_ComboStatus status = {};
+    ButtonComboModule_Error error        = {};
+    auto combo                           = ButtonComboModule::CreateComboEx(options, status, error);
+    CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    if (!combo) {
+        return Test::Result("CallbackSlotStress");
+    }
+
+    std::optional<ButtonComboModule::CallbackSlot> slot;
+    slot.emplace(*combo);
+    CHECK_ERROR(slot->GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Dispatches outside of the module lock, so swaps really overlap running callbacks.
+    FakeModule::SetCallbacksUnlocked(true);
+    std::thread vpad(InputThread, BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+    std::thread wpad(InputThread, BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0);
+    while (sContexts[0].calls == 0) {
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < SWAP_COUNT; i++) {
+        Context &previous = sContexts[i % CONTEXT_COUNT];
+        Context &next     = sContexts[(i + 1) % CONTEXT_COUNT];
+        next.alive        = true;
+
+        ButtonComboModule_CallbackOptions oldOptions = {};
+        CHECK_ERROR(slot->Swap(OnCombo, &next, &oldOptions), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(oldOptions.context == &previous);
+        previous.alive = false;
+    }
+
+    // Restores the last published pair, which stays alive until the input threads are done. The slot itself stays alive
+    // until the combo has been removed.
+    CHECK_ERROR(slot->Uninstall(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    sRunning = false;
+    vpad.join();
+    wpad.join();
+    FakeModule::SetCallbacksUnlocked(false);
+
+    uint32_t calls = 0;
+    for (const auto &context : sContexts) {
+        calls += context.calls;
+    }
+    CHECK(sViolations == 0);
+    CHECK(calls > 0);
+
+    combo.reset();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("CallbackSlotStress");
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <cstring>
+#include <string>
+
+/**
+ * Lists the combos that block a proposed or an added combo, classifies them and truncates the list and the labels.
+ */
+
+namespace {
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    ButtonComboModule_ComboHandle Add(const char *label,
+                                      const ButtonComboModule_ControllerTypes controllerMask,
+                                      const ButtonComboModule_Buttons buttons,
+                                      const bool observer,
+                                      const ButtonComboModule_ComboStatus expectedStatus) {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownEx(label, controllerMask, buttons, OnCombo, nullptr, observer, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == expectedStatus);
+        return handle;
+    }
+
+    // Checks a proposed combo on the GamePad that is expected to be blocked by exactly one combo.
+    void CheckSingleConflict(const ButtonComboModule_Buttons buttons, const ButtonComboModule_ComboHandle blocker, const ButtonComboModule_ConflictKind kind) {
+        const ButtonComboModule_ButtonComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = buttons};
+
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_CheckComboAvailable(&options, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+
+        ButtonComboModule::ComboConflicts<4> conflicts;
+        CHECK_ERROR(ButtonComboModule::GetComboConflicts(options, conflicts), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(conflicts.size() == 1);
+        if (conflicts.size() == 1) {
+            CHECK(conflicts[0].handle == blocker);
+            CHECK(conflicts[0].kind == kind);
+        }
+    }
+
+    void TestProposedCombos() {
+        const auto lr = Add("L+R", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, false, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        // Observers never block other combos.
+        const auto observer = Add("Observer", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L, true, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        CheckSingleConflict(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, lr, BUTTON_COMBO_MODULE_CONFLICT_KIND_IDENTICAL);
+        CheckSingleConflict(BCMPAD_BUTTON_X | BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, lr, BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET);
+        CheckSingleConflict(BCMPAD_BUTTON_L, lr, BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET);
+
+        ButtonComboModule_ConflictInfo info                  = {};
+        uint32_t count                                       = 0;
+        const ButtonComboModule_ButtonComboOptions lrOptions = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = BCMPAD_BUTTON_L | BCMPAD_BUTTON_R};
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&lrOptions, &info, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 1);
+        CHECK(info.type == BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN);
+        CHECK(info.controllerMask == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(info.combo == (BCMPAD_BUTTON_L | BCMPAD_BUTTON_R));
+        CHECK(strcmp(info.label, "L+R") == 0);
+
+        // Neither unrelated buttons nor other controllers conflict.
+        const ButtonComboModule_ButtonComboOptions unrelated = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = BCMPAD_BUTTON_L | BCMPAD_BUTTON_X};
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&unrelated, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 0);
+        const ButtonComboModule_ButtonComboOptions wiimote = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, .combo = BCMPAD_BUTTON_L | BCMPAD_BUTTON_R};
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&wiimote, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 0);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(observer), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(lr), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestAddedCombo() {
+        const auto lr = Add("L+R", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, false, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto xlr                             = ButtonComboModule::CreateComboPressDownEx("X+L+R", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_X | BCMPAD_BUTTON_L | BCMPAD_BUTTON_R,
+                                                                                         OnCombo, nullptr, false, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+        if (!xlr) {
+            return;
+        }
+        // Only the VALID combo triggers.
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_X | BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 1);
+
+        ButtonComboModule::ComboConflicts<2> conflicts;
+        CHECK_ERROR(xlr->GetConflicts(conflicts), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(conflicts.size() == 1);
+        if (conflicts.size() == 1) {
+            CHECK(conflicts[0].handle == lr);
+            CHECK(conflicts[0].kind == BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET);
+        }
+
+        // The blocking combo itself is VALID, so nothing blocks it.
+        uint32_t count = 1;
+        CHECK_ERROR(ButtonComboModule_GetButtonComboConflicts(lr, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 0);
+
+        // Resolved by updating the combo after the blocker is gone.
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(lr), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(xlr->UpdateButtonCombo(BCMPAD_BUTTON_X | BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        CHECK_ERROR(xlr->GetConflicts(conflicts), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(conflicts.empty());
+    }
+
+    void TestTruncation() {
+        const std::string longLabel(BUTTON_COMBO_MODULE_CONFLICT_LABEL_LENGTH + 10, 'x');
+        const auto l  = Add(longLabel.c_str(), BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L, false, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        const auto zl = Add("ZL", BUTTON_COMBO_MODULE_CONTROLLER_ALL, BCMPAD_BUTTON_ZL, false, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        const ButtonComboModule_ButtonComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = BCMPAD_BUTTON_L | BCMPAD_BUTTON_ZL};
+        ButtonComboModule_ConflictInfo infos[2]            = {};
+        uint32_t count                                     = 0;
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&options, infos, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 2);
+        CHECK(infos[1].handle == nullptr);
+        CHECK(strlen(infos[0].label) == BUTTON_COMBO_MODULE_CONFLICT_LABEL_LENGTH - 1);
+
+        ButtonComboModule::ComboConflicts<1> conflicts;
+        CHECK_ERROR(ButtonComboModule::GetComboConflicts(options, conflicts), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(conflicts.size() == 1);
+        ButtonComboModule::ComboConflicts<2> allConflicts;
+        CHECK_ERROR(ButtonComboModule::GetComboConflicts(options, allConflicts), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(allConflicts.size() == 2);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(l), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(zl), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestExpressions() {
+        const auto lrzr = Add("L+R+ZR", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_ZR, false, BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        // "L+R without ZR" never triggers together with "L+R+ZR".
+        const ButtonComboModule_ComboExpression withoutZR = {.required = BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, .forbidden = BCMPAD_BUTTON_ZR};
+        ButtonComboModule_ComboHandle handle              = {};
+        ButtonComboModule_ComboStatus status              = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboExpression("L+R without ZR", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, &withoutZR, 0, OnCombo, nullptr, false, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        // Every state that triggers "L+R without ZR" triggers "L+R" as well.
+        const auto lr = Add("L+R", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, false, BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+        ButtonComboModule_ConflictInfo infos[2] = {};
+        uint32_t count                          = 0;
+        CHECK_ERROR(ButtonComboModule_GetButtonComboConflicts(lr, infos, 2, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 2);
+        // Both are supersets of L+R, every state that triggers one of them triggers L+R as well.
+        CHECK(infos[0].kind == BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET);
+        CHECK(infos[1].kind == BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET);
+        CHECK((infos[0].handle == lrzr && infos[1].handle == handle) || (infos[0].handle == handle && infos[1].handle == lrzr));
+
+        const ButtonComboModule_ComboHandle handles[] = {lrzr, handle, lr};
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombos(handles, 3), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestArguments() {
+        const ButtonComboModule_ButtonComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = BCMPAD_BUTTON_A};
+        ButtonComboModule_ConflictInfo info                = {};
+        uint32_t count                                     = 0;
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(nullptr, &info, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&options, nullptr, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetComboConflicts(&options, &info, 1, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboConflicts(ButtonComboModule_ComboHandle(nullptr), &info, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboConflicts(ButtonComboModule_ComboHandle(&info), &info, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestProposedCombos();
+    TestAddedCombo();
+    TestTruncation();
+    TestExpressions();
+    TestArguments();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Modules with API version 1 don't have the exports.
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    const ButtonComboModule_ButtonComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = BCMPAD_BUTTON_A};
+    uint32_t count                                     = 0;
+    CHECK_ERROR(ButtonComboModule_GetComboConflicts(&options, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Conflicts");
+}
\ No newline at end of file
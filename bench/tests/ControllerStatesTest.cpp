@@ -0,0 +1,132 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+/**
+ * Reads the last sample of each controller back through ButtonComboModule_GetControllerStates: ordering, stick
+ * directions, truncated buffers and the state of the triggering controller from within a combo callback.
+ */
+
+namespace {
+    constexpr auto NONE = static_cast<ButtonComboModule_Buttons>(0);
+
+    void TestInitialStates() {
+        ButtonComboModule::ControllerStates states;
+        CHECK_ERROR(ButtonComboModule::GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_ALL, states), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(states.size() == BUTTON_COMBO_MODULE_CONTROLLER_COUNT);
+        for (uint32_t i = 0; i < states.size(); i++) {
+            CHECK(states[i].controller == (1u << i));
+            CHECK(states[i].buttons == NONE);
+            CHECK(states[i].sampleTime == 0);
+            CHECK(!states[i].connected);
+        }
+    }
+
+    void TestLastSample() {
+        const OSTime first  = OSMillisecondsToTicks(100);
+        const OSTime second = OSMillisecondsToTicks(116);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, {0.8f, 0.0f}, {0.0f, -0.8f}, first);
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1, BCMPAD_BUTTON_1, first);
+
+        ButtonComboModule_ControllerState states[BUTTON_COMBO_MODULE_CONTROLLER_COUNT] = {};
+        uint32_t count                                                                 = 0;
+        const auto mask                                                                = static_cast<ButtonComboModule_ControllerTypes>(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1 | BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(mask, states, BUTTON_COMBO_MODULE_CONTROLLER_COUNT, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 2);
+        // Ordered by the controller bits, not by the time of the sample.
+        CHECK(states[0].controller == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(states[0].buttons == (BCMPAD_BUTTON_A | BCMPAD_BUTTON_B | BCMPAD_BUTTON_STICK_L_RIGHT | BCMPAD_BUTTON_STICK_R_DOWN));
+        CHECK(states[0].sampleTime == first);
+        CHECK(states[0].connected);
+        CHECK(states[1].controller == BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1);
+        CHECK(states[1].buttons == BCMPAD_BUTTON_1);
+        CHECK(states[1].connected);
+
+        // The stick directions use the default thresholds, including the hysteresis.
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A, {0.45f, 0.0f}, {0.0f, -0.3f}, second);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, states, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 1);
+        CHECK(states[0].buttons == (BCMPAD_BUTTON_A | BCMPAD_BUTTON_STICK_L_RIGHT));
+        CHECK(states[0].sampleTime == second);
+
+        // Samples injected through the API show up as well.
+        const ButtonComboModule_InputSample sample = {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_X, .sampleTime = second + 1};
+        CHECK_ERROR(ButtonComboModule_InjectInput(&sample, 1), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, states, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(states[0].buttons == BCMPAD_BUTTON_X);
+        CHECK(states[0].sampleTime == second + 1);
+
+        // Reading the states doesn't consume them.
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, states, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(states[0].buttons == BCMPAD_BUTTON_X);
+    }
+
+    void TestBufferTooSmall() {
+        ButtonComboModule_ControllerState states[2] = {};
+        uint32_t count                              = 0;
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_ALL, states, 2, &count), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(count == 2);
+        CHECK(states[0].controller == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(states[1].controller == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_1);
+
+        count = 1;
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(count == 0);
+    }
+
+    void TestArguments() {
+        ButtonComboModule_ControllerState state = {};
+        uint32_t count                          = 0;
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_NONE, &state, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(static_cast<ButtonComboModule_ControllerTypes>(1 << BUTTON_COMBO_MODULE_CONTROLLER_COUNT), &state, 1, &count),
+                    BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, nullptr, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, &state, 1, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+
+    ButtonComboModule_ControllerState sTriggerState = {};
+
+    void OnCombo(const ButtonComboModule_ControllerTypes triggeredBy, ButtonComboModule_ComboHandle, void *) {
+        uint32_t count = 0;
+        CHECK_ERROR(ButtonComboModule_GetControllerStates(triggeredBy, &sTriggerState, 1, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestFromCallback() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("States", BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_ZR, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        // The callback sees the sample that triggered the combo, including the buttons that aren't part of it.
+        const OSTime time = OSMillisecondsToTicks(500);
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_2, BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_ZR | BCMPAD_BUTTON_PLUS, time) == 1);
+        CHECK(sTriggerState.controller == BUTTON_COMBO_MODULE_CONTROLLER_WPAD_2);
+        CHECK(sTriggerState.buttons == (BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_ZR | BCMPAD_BUTTON_PLUS));
+        CHECK(sTriggerState.sampleTime == time);
+        CHECK(sTriggerState.connected);
+    }
+
+    void TestVersion1() {
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        ButtonComboModule::ControllerStates states;
+        CHECK_ERROR(ButtonComboModule::GetControllerStates(BUTTON_COMBO_MODULE_CONTROLLER_ALL, states), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK(states.empty());
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestInitialStates();
+    TestLastSample();
+    TestBufferTooSmall();
+    TestArguments();
+    TestFromCallback();
+    TestVersion1();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("ControllerStates");
+}
\ No newline at end of file
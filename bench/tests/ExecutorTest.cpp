@@ -0,0 +1,129 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboExecutor.h>
+#include <buttoncombo/api.h>
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <thread>
+
+/**
+ * Runs combo callbacks through the queue and thread executors, and unbinds a combo while a trigger is still being
+ * posted to its executor. Bindings outlive their combos.
+ */
+
+namespace {
+    std::atomic<uint32_t> sCallCount = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sCallCount++;
+    }
+
+    std::optional<ButtonComboModule::ButtonCombo> CreateCombo(const ButtonComboModule_Buttons buttons) {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Executor", buttons, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return combo;
+    }
+
+    void TestQueueExecutor() {
+        ButtonComboModule::QueueExecutor<2> executor;
+        std::optional<ButtonComboModule::ExecutorBinding> binding;
+        auto combo = CreateCombo(BCMPAD_BUTTON_A);
+        if (!combo) {
+            return;
+        }
+        sCallCount = 0;
+        binding.emplace(*combo, executor);
+        CHECK_ERROR(binding->GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        CHECK(sCallCount == 0);
+        CHECK(binding->GetDroppedCount() == 1);
+        CHECK(executor.Drain() == 2);
+        CHECK(sCallCount == 2);
+
+        CHECK_ERROR(binding->Unbind(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        // The original callback is back in place.
+        FakeModule::Press(BCMPAD_BUTTON_A);
+        CHECK(sCallCount == 3);
+        CHECK(executor.Drain() == 0);
+    }
+
+    void TestThreadExecutor() {
+        constexpr uint32_t PRESS_COUNT = 1000;
+        auto combo                     = CreateCombo(BCMPAD_BUTTON_B);
+        if (!combo) {
+            return;
+        }
+        sCallCount       = 0;
+        uint32_t dropped = 0;
+        {
+            ButtonComboModule::ThreadExecutor executor;
+            ButtonComboModule::ExecutorBinding binding(*combo, executor);
+            CHECK_ERROR(binding.GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            for (uint32_t i = 0; i < PRESS_COUNT; i++) {
+                FakeModule::Press(BCMPAD_BUTTON_B);
+            }
+            dropped = binding.GetDroppedCount();
+            // Removed while the binding is still alive.
+            combo.reset();
+        }
+        // Destroying the executor runs everything that has been accepted.
+        CHECK(sCallCount + dropped == PRESS_COUNT);
+        CHECK(sCallCount > 0);
+    }
+
+    // Rejects every trigger, but only after the combo had the chance to be unbound.
+    class SlowExecutor : public ButtonComboModule::CallbackExecutor {
+    public:
+        bool Post(const ButtonComboModule_TriggerRecord &) noexcept override {
+            entered = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            returned = true;
+            return false;
+        }
+
+        std::atomic<bool> entered  = false;
+        std::atomic<bool> returned = false;
+    };
+
+    void TestUnbindWhilePosting() {
+        SlowExecutor executor;
+        std::optional<ButtonComboModule::ExecutorBinding> binding;
+        auto combo = CreateCombo(BCMPAD_BUTTON_X);
+        if (!combo) {
+            return;
+        }
+        binding.emplace(*combo, executor);
+        CHECK_ERROR(binding->GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        FakeModule::SetCallbacksUnlocked(true);
+        std::thread input([] { FakeModule::Press(BCMPAD_BUTTON_X); });
+        while (!executor.entered) {
+            std::this_thread::yield();
+        }
+        // The trampoline still has to count the rejected trigger, unbinding waits until it returns.
+        CHECK_ERROR(binding->Unbind(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(executor.returned);
+        input.join();
+        FakeModule::SetCallbacksUnlocked(false);
+
+        sCallCount = 0;
+        FakeModule::Press(BCMPAD_BUTTON_X);
+        CHECK(sCallCount == 1);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestQueueExecutor();
+    TestThreadExecutor();
+    TestUnbindWhilePosting();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Executor");
+}
\ No newline at end of file
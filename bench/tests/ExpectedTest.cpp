@@ -0,0 +1,75 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <string>
+#include <type_traits>
+
+/**
+ * Built with C++23 against the library that is built with C++20, so the TryCreate functions only link if both use the
+ * same expected. Also copies and moves expecteds between the value and the error state.
+ */
+
+namespace {
+    using ButtonComboModule::expected;
+    using ButtonComboModule::unexpected;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    void TestTryCreate() {
+#ifdef __cpp_lib_expected
+        static_assert(!std::is_same_v<expected<int, int>, std::expected<int, int>>);
+#endif
+        ButtonComboModule_ComboStatus status = {};
+        auto combo                           = ButtonComboModule::TryCreateComboPressDown("A", BCMPAD_BUTTON_A, OnCombo, nullptr, status);
+        CHECK(combo.has_value());
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        auto invalid = ButtonComboModule::TryCreateComboPressDown("None", static_cast<ButtonComboModule_Buttons>(0), OnCombo, nullptr, status);
+        CHECK(!invalid);
+        CHECK(invalid.error() == BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO);
+
+        // Moving the combo out of the expected keeps it registered.
+        invalid = std::move(combo);
+        CHECK(invalid.has_value());
+        CHECK(FakeModule::GetComboCount() == 1);
+    }
+
+    void TestCopyAssignment() {
+        const expected<std::string, int> value = std::string("value");
+        const expected<std::string, int> error = unexpected(42);
+
+        expected<std::string, int> copy = std::string("other");
+        copy                            = value;
+        CHECK(copy.has_value());
+        CHECK(*copy == "value");
+        CHECK(*value == "value");
+
+        copy = error;
+        CHECK(!copy.has_value());
+        CHECK(copy.error() == 42);
+
+        copy = value;
+        CHECK(copy.has_value());
+        CHECK(*copy == "value");
+
+        const auto &self = copy;
+        copy             = self;
+        CHECK(*copy == "value");
+
+        static_assert(std::is_copy_assignable_v<expected<std::string, int>>);
+        static_assert(!std::is_copy_assignable_v<expected<ButtonComboModule::ButtonCombo, ButtonComboModule_Error>>);
+        static_assert(std::is_move_assignable_v<expected<ButtonComboModule::ButtonCombo, ButtonComboModule_Error>>);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestTryCreate();
+    TestCopyAssignment();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Expected");
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+/**
+ * Evaluates expression combos with required, any-of and forbidden buttons, including the virtual stick direction
+ * buttons that are part of the held mask.
+ */
+
+namespace {
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    constexpr FakeModule::StickPosition STICK_LEFT = {-1.0f, 0.0f};
+
+    ButtonComboModule_ComboHandle AddExpression(const ButtonComboModule_ComboExpression &expression) {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboExpression("Expression", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, &expression, 0, OnCombo, nullptr, false, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        return handle;
+    }
+
+    void TestAnyOfAndForbidden() {
+        // "A or B while ZR is not held"
+        const auto handle = AddExpression({.anyOf = {BCMPAD_BUTTON_A | BCMPAD_BUTTON_B}, .forbidden = BCMPAD_BUTTON_ZR});
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_B) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A | BCMPAD_BUTTON_B) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A | BCMPAD_BUTTON_ZR) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_X) == 0);
+
+        ButtonComboModule_ComboExpression expression = {};
+        CHECK_ERROR(ButtonComboModule_GetComboExpression(handle, &expression), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(expression.required == 0);
+        CHECK(expression.anyOf[0] == (BCMPAD_BUTTON_A | BCMPAD_BUTTON_B));
+        CHECK(expression.anyOf[1] == 0);
+        CHECK(expression.forbidden == BCMPAD_BUTTON_ZR);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestRequiredAndAnyOf() {
+        // "ZL and (A or B) and (X or Y)"
+        const auto handle = AddExpression({.required = BCMPAD_BUTTON_ZL,
+                                           .anyOf    = {BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, BCMPAD_BUTTON_X | BCMPAD_BUTTON_Y}});
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_A | BCMPAD_BUTTON_Y) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_B | BCMPAD_BUTTON_X) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_A) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A | BCMPAD_BUTTON_X) == 0);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestExactlyLR() {
+        // The documented way only forbids the other physical buttons, a tilted stick doesn't matter.
+        const auto exact = AddExpression({.required  = BCMPAD_BUTTON_L | BCMPAD_BUTTON_R,
+                                          .forbidden = BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & ~(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R)});
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, STICK_LEFT) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_A) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_C) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_TV) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L) == 0);
+
+        // Inverting the required mask forbids the stick directions as well.
+        ButtonComboModule_ComboStatus status             = {};
+        const ButtonComboModule_ComboExpression inverted = {.required  = BCMPAD_BUTTON_L | BCMPAD_BUTTON_R,
+                                                            .forbidden = ~(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R)};
+        CHECK_ERROR(ButtonComboModule_UpdateComboExpression(exact, &inverted, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, STICK_LEFT) == 0);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(exact), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        const auto helper = AddExpression(ButtonComboModule::ExactComboExpression(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R));
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, STICK_LEFT) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_Z) == 0);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(helper), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestMasks() {
+        CHECK((BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & BUTTON_COMBO_MODULE_STICK_DIRECTION_BUTTONS) == 0);
+        CHECK((BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & BCMPAD_BUTTON_RESERVED_BIT) == 0);
+        CHECK(BUTTON_COMBO_MODULE_STICK_DIRECTION_BUTTONS == (BCMPAD_BUTTON_STICK_L_LEFT | BCMPAD_BUTTON_STICK_L_RIGHT | BCMPAD_BUTTON_STICK_L_UP | BCMPAD_BUTTON_STICK_L_DOWN |
+                                                              BCMPAD_BUTTON_STICK_R_LEFT | BCMPAD_BUTTON_STICK_R_RIGHT | BCMPAD_BUTTON_STICK_R_UP | BCMPAD_BUTTON_STICK_R_DOWN));
+        for (const auto button : {BCMPAD_BUTTON_A, BCMPAD_BUTTON_MINUS, BCMPAD_BUTTON_1, BCMPAD_BUTTON_2, BCMPAD_BUTTON_TV, BCMPAD_BUTTON_STICK_L, BCMPAD_BUTTON_STICK_R,
+                                  BCMPAD_BUTTON_C, BCMPAD_BUTTON_Z}) {
+            CHECK((BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & button) == button);
+        }
+    }
+
+    void TestInvalidExpressions() {
+        ButtonComboModule_ComboHandle handle          = {};
+        ButtonComboModule_ComboStatus status          = {};
+        const ButtonComboModule_ComboExpression empty = {.forbidden = BCMPAD_BUTTON_ZR};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboExpression("Expression", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, &empty, 0, OnCombo, nullptr, false, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO);
+        const ButtonComboModule_ComboExpression overlapping = {.required = BCMPAD_BUTTON_A, .forbidden = BCMPAD_BUTTON_A | BCMPAD_BUTTON_B};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboExpression("Expression", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, &overlapping, 0, OnCombo, nullptr, false, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO);
+        CHECK(FakeModule::GetComboCount() == 0);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestMasks();
+    TestAnyOfAndForbidden();
+    TestRequiredAndAnyOf();
+    TestExactlyLR();
+    TestInvalidExpressions();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Expression");
+}
\ No newline at end of file
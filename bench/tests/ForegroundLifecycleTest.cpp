@@ -0,0 +1,192 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboGroup.h>
+#include <buttoncombo/api.h>
+
+/**
+ * Sends the app to the background and back with the foreground lifecycle mode enabled. Combos must come back with the
+ * status they had before, including combos in a user group, C handles and combos added while in the background.
+ */
+
+namespace {
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    ButtonComboModule_ComboStatus GetStatus(const ButtonComboModule_ComboHandle handle) {
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_GetButtonComboStatus(handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return status;
+    }
+
+    std::optional<ButtonComboModule::ButtonCombo> CreateCombo(const char *label, const ButtonComboModule_Buttons buttons) {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown(label, buttons, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return combo;
+    }
+
+    void TestStatusesAreKept() {
+        auto combo = CreateCombo("Menu", BCMPAD_BUTTON_L | BCMPAD_BUTTON_R);
+        if (!combo) {
+            return;
+        }
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 1);
+
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 0);
+        CHECK(GetStatus(combo->getHandle()) == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        // The suspended combo still reserves its buttons, a combo added in the background can't take them over.
+        ButtonComboModule_ComboHandle other  = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Other", BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, OnCombo, nullptr, &other, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+
+        FakeModule::SetForeground(true);
+        CHECK(GetStatus(combo->getHandle()) == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        CHECK(GetStatus(other) == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R) == 1);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(other), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestUserGroup() {
+        auto grouped = CreateCombo("Grouped", BCMPAD_BUTTON_A);
+        auto hidden  = CreateCombo("Hidden", BCMPAD_BUTTON_B);
+        auto group   = ButtonComboModule::ButtonComboGroup::TryCreate();
+        CHECK(group.has_value());
+        if (!grouped || !hidden || !group) {
+            return;
+        }
+        CHECK_ERROR(group->Add(*grouped), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(group->Add(*hidden), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(group->SetEnabled(false), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(group->Remove(*grouped), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        // Combos in a user group are suspended as well, the group keeps working in the background.
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 0);
+        CHECK_ERROR(group->Add(*grouped), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(group->SetEnabled(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_B) == 0);
+        CHECK_ERROR(group->SetEnabled(false), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        // Resuming doesn't enable the group.
+        FakeModule::SetForeground(true);
+        CHECK(GetStatus(grouped->getHandle()) == BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED);
+        CHECK(GetStatus(hidden->getHandle()) == BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 0);
+        CHECK_ERROR(group->SetEnabled(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_B) == 1);
+    }
+
+    void TestExemptAndLateCombos() {
+        auto exempt = CreateCombo("Exempt", BCMPAD_BUTTON_X);
+        if (!exempt) {
+            return;
+        }
+        CHECK_ERROR(exempt->SetForegroundLifecycleExempt(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(exempt->IsForegroundLifecycleExempt());
+
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("C", BCMPAD_BUTTON_Y, OnCombo, nullptr, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_X) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_Y) == 0);
+        CHECK_ERROR(ButtonComboModule_SetButtonComboSuspendExempt(handle, true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_Y) == 1);
+        CHECK_ERROR(ButtonComboModule_SetButtonComboSuspendExempt(handle, false), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_Y) == 0);
+
+        // Moving keeps the exemption, combos created in the background are suspended right away.
+        auto moved = std::move(*exempt);
+        CHECK(moved.IsForegroundLifecycleExempt());
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_X) == 1);
+        auto late = CreateCombo("Late", BCMPAD_BUTTON_ZL);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZL) == 0);
+
+        FakeModule::SetForeground(true);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_X) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_Y) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZL) == 1);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        CHECK_ERROR(ButtonComboModule_SetButtonComboSuspendExempt({}, true), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_SetButtonComboSuspendExempt(handle, true), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+
+    void TestDisableInBackground() {
+        auto combo = CreateCombo("Disable", BCMPAD_BUTTON_ZR);
+        if (!combo) {
+            return;
+        }
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZR) == 0);
+        CHECK_ERROR(ButtonComboModule_SetForegroundLifecycleEnabled(false), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZR) == 1);
+
+        // The callbacks stay registered, but do nothing while the mode is disabled.
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_ZR) == 1);
+        FakeModule::SetForeground(true);
+        CHECK_ERROR(ButtonComboModule_SetForegroundLifecycleEnabled(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_SetForegroundLifecycleEnabled(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestDeInitResumes() {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Kept", BCMPAD_BUTTON_PLUS, OnCombo, nullptr, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_PLUS) == 0);
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_PLUS) == 1);
+
+        // The mode is off after the library has been initialized again.
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_PLUS) == 1);
+        FakeModule::SetForeground(true);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestVersion1() {
+        auto combo = CreateCombo("Version1", BCMPAD_BUTTON_MINUS);
+        if (!combo) {
+            return;
+        }
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_SetForegroundLifecycleEnabled(true), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+
+        combo = CreateCombo("Version1", BCMPAD_BUTTON_MINUS);
+        if (!combo) {
+            return;
+        }
+        CHECK_ERROR(combo->SetForegroundLifecycleExempt(true), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK(!combo->IsForegroundLifecycleExempt());
+        FakeModule::SetForeground(false);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_MINUS) == 1);
+        FakeModule::SetForeground(true);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK_ERROR(ButtonComboModule_SetForegroundLifecycleEnabled(true), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestStatusesAreKept();
+    TestUserGroup();
+    TestExemptAndLateCombos();
+    TestDisableInBackground();
+    TestDeInitResumes();
+    TestVersion1();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK(FakeModule::GetComboCount() == 0);
+    return Test::Result("ForegroundLifecycle");
+}
\ No newline at end of file
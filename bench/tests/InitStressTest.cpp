@@ -0,0 +1,89 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/**
+ * Initializes and deinitializes the library from several threads while they add and remove combos, input is evaluated
+ * and another thread keeps calling into the library without holding a reference.
+ */
+
+namespace {
+    constexpr uint32_t APP_THREAD_COUNT = 4;
+    constexpr uint32_t ITERATIONS       = 20000;
+
+    std::atomic<bool> sRunning        = true;
+    std::atomic<uint32_t> sIterations = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    void AppThread(const uint32_t index) {
+        for (uint32_t i = 0; i < ITERATIONS; i++) {
+            CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+            ButtonComboModule_ComboStatus status = BUTTON_COMBO_MODULE_COMBO_STATUS_INVALID_STATUS;
+            ButtonComboModule_Error error        = BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR;
+            auto combo                           = ButtonComboModule::CreateComboPressDown("InitStress", BCMPAD_BUTTON_A, OnCombo, nullptr, status, error);
+            CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(combo.has_value());
+            if (combo) {
+                CHECK_ERROR(combo->GetButtonComboStatus(status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            }
+
+            // Sometimes drop the reference while the combo is still alive, the last DeInit releases it.
+            if ((i + index) % 8 == 0) {
+                CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+                combo.reset();
+            } else {
+                combo.reset();
+                CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            }
+            sIterations++;
+        }
+    }
+
+    // Calls into the library without taking a reference, races with the dispatch table being unpublished.
+    void UnreferencedThread() {
+        ButtonComboModule_ComboStatus status = {};
+        while (sRunning) {
+            const auto res = ButtonComboModule_GetButtonComboStatus(ButtonComboModule_ComboHandle(&status), &status);
+            CHECK(res == BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED || res == BUTTON_COMBO_MODULE_ERROR_HANDLE_NOT_FOUND);
+        }
+    }
+
+    void InputThread() {
+        while (sRunning) {
+            FakeModule::Press(BCMPAD_BUTTON_A);
+        }
+    }
+} // namespace
+
+int main() {
+    std::vector<std::thread> appThreads;
+    for (uint32_t i = 0; i < APP_THREAD_COUNT; i++) {
+        appThreads.emplace_back(AppThread, i);
+    }
+    std::thread unreferenced(UnreferencedThread);
+    std::thread input(InputThread);
+
+    for (auto &thread : appThreads) {
+        thread.join();
+    }
+    sRunning = false;
+    unreferenced.join();
+    input.join();
+
+    CHECK(sIterations == APP_THREAD_COUNT * ITERATIONS);
+    CHECK(FakeModule::GetAcquireCount() == 0);
+    CHECK(FakeModule::GetComboCount() == 0);
+
+    ButtonComboModule_ComboStatus status = {};
+    CHECK_ERROR(ButtonComboModule_GetButtonComboStatus(ButtonComboModule_ComboHandle(&status), &status), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+    return Test::Result("InitStress");
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <cstdio>
+
+/**
+ * Runs the same scenario through the thin C wrappers. The Makefile builds it with and without BUTTONCOMBO_INLINE and
+ * compares the output of both builds, so the two modes have to behave identically, including the
+ * LIB_UNINITIALIZED and UNSUPPORTED_COMMAND paths.
+ */
+
+namespace {
+    uint32_t sTriggerCount = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sTriggerCount++;
+    }
+
+    ButtonComboModule_Error Report(const char *step, const ButtonComboModule_Error res) {
+        printf("%s: %s\n", step, ButtonComboModule_GetStatusStr(res));
+        return res;
+    }
+
+    ButtonComboModule_ComboOptions MakeOptions(const int version, const ButtonComboModule_Buttons buttons) {
+        ButtonComboModule_ComboOptions options               = {};
+        options.version                                      = version;
+        options.metaOptions.label                            = "InlineModes";
+        options.callbackOptions                              = {.callback = OnCombo, .context = nullptr};
+        options.buttonComboOptions.type                      = BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+        options.buttonComboOptions.basicCombo.combo          = buttons;
+        options.buttonComboOptions.basicCombo.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0;
+        return options;
+    }
+
+    void RunUninitialized() {
+        ButtonComboModule_ComboHandle handle         = {};
+        ButtonComboModule_ComboStatus status         = {};
+        ButtonComboModule_ButtonComboInfoEx info     = {};
+        const ButtonComboModule_ComboOptions options = MakeOptions(BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION, BCMPAD_BUTTON_A);
+
+        CHECK_ERROR(Report("uninitialized AddButtonCombo", ButtonComboModule_AddButtonCombo(&options, &handle, &status)), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+        CHECK_ERROR(Report("uninitialized GetButtonComboStatus", ButtonComboModule_GetButtonComboStatus(handle, &status)), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+        CHECK_ERROR(Report("uninitialized GetButtonComboInfoEx", ButtonComboModule_GetButtonComboInfoEx(handle, &info)), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+        CHECK_ERROR(Report("uninitialized RemoveButtonCombos", ButtonComboModule_RemoveButtonCombos(&handle, 1)), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+        CHECK_ERROR(Report("uninitialized InjectInput", ButtonComboModule_InjectInput(nullptr, 0)), BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED);
+    }
+
+    void RunVersion1() {
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(Report("v1 InitLibrary", ButtonComboModule_InitLibrary()), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        auto options                         = MakeOptions(BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX, BCMPAD_BUTTON_A);
+        CHECK_ERROR(Report("v1 AddButtonCombo (options v2)", ButtonComboModule_AddButtonCombo(&options, &handle, &status)), BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION);
+        options = MakeOptions(BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION, BCMPAD_BUTTON_A);
+        CHECK_ERROR(Report("v1 AddButtonCombo", ButtonComboModule_AddButtonCombo(&options, &handle, &status)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        ButtonComboModule_ComboExpression expression = {};
+        const ButtonComboModule_InputSample sample   = {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_A, .sampleTime = 0};
+        CHECK_ERROR(Report("v1 RemoveButtonCombos", ButtonComboModule_RemoveButtonCombos(&handle, 1)), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(Report("v1 GetComboExpression", ButtonComboModule_GetComboExpression(handle, &expression)), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(Report("v1 InjectInput", ButtonComboModule_InjectInput(&sample, 1)), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(Report("v1 GetButtonComboStatus", ButtonComboModule_GetButtonComboStatus(handle, &status)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(Report("v1 RemoveButtonCombo", ButtonComboModule_RemoveButtonCombo(handle)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        CHECK_ERROR(Report("v1 DeInitLibrary", ButtonComboModule_DeInitLibrary()), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetApiVersion(2);
+    }
+
+    void RunVersion2() {
+        FakeModule::SetMissingExport("ButtonComboModule_GetComboSnapshot");
+        CHECK_ERROR(Report("v2 InitLibrary", ButtonComboModule_InitLibrary()), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        ButtonComboModule_ComboHandle handles[2] = {};
+        ButtonComboModule_ComboStatus status     = {};
+        auto options                             = MakeOptions(BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX, BCMPAD_BUTTON_A);
+        CHECK_ERROR(Report("v2 AddButtonCombo (options v2)", ButtonComboModule_AddButtonCombo(&options, &handles[0], &status)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        options = MakeOptions(BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION, BCMPAD_BUTTON_B);
+        CHECK_ERROR(Report("v2 AddButtonCombo", ButtonComboModule_AddButtonCombo(&options, &handles[1], &status)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(Report("v2 AddButtonCombo (no options)", ButtonComboModule_AddButtonCombo(nullptr, &handles[1], &status)), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        const ButtonComboModule_InputSample samples[] = {
+                {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_A, .sampleTime = OSMillisecondsToTicks(0)},
+                {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = static_cast<ButtonComboModule_Buttons>(0), .sampleTime = OSMillisecondsToTicks(16)},
+                {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_B, .sampleTime = OSMillisecondsToTicks(32)},
+        };
+        CHECK_ERROR(Report("v2 InjectInput", ButtonComboModule_InjectInput(samples, 3)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        printf("v2 triggers: %u\n", sTriggerCount);
+        CHECK(sTriggerCount == 2);
+
+        ButtonComboModule_ComboExpression expression = {};
+        uint32_t snapshotSize                        = 0;
+        CHECK_ERROR(Report("v2 GetComboExpression", ButtonComboModule_GetComboExpression(handles[0], &expression)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(expression.required == BCMPAD_BUTTON_A);
+        CHECK_ERROR(Report("v2 GetComboSnapshot (missing export)", ButtonComboModule_GetComboSnapshot(nullptr, 0, &snapshotSize)), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(Report("v2 RemoveButtonCombos (no handles)", ButtonComboModule_RemoveButtonCombos(nullptr, 2)), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(Report("v2 RemoveButtonCombos", ButtonComboModule_RemoveButtonCombos(handles, 2)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        printf("v2 remaining combos: %u\n", FakeModule::GetComboCount());
+        CHECK(FakeModule::GetComboCount() == 0);
+
+        CHECK_ERROR(Report("v2 DeInitLibrary", ButtonComboModule_DeInitLibrary()), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetMissingExport(nullptr);
+    }
+} // namespace
+
+int main() {
+    RunUninitialized();
+    RunVersion1();
+    RunVersion2();
+    RunUninitialized();
+    return Test::Result("InlineModes");
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboInjection.h>
+#include <buttoncombo/api.h>
+
+/**
+ * Runs scripted input through ButtonComboModule::InputInjection: masking of the real input, hold combos driven by
+ * injected samples and restoring the mask that was set before the injection, including nested injections.
+ */
+
+namespace {
+    constexpr auto NONE = static_cast<ButtonComboModule_Buttons>(0);
+
+    uint32_t sTriggered = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sTriggered++;
+    }
+
+    ButtonComboModule_ControllerTypes GetMask() {
+        auto mask = BUTTON_COMBO_MODULE_CONTROLLER_NONE;
+        CHECK_ERROR(ButtonComboModule_GetRealInputMask(&mask), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return mask;
+    }
+
+    void TestScriptedHold() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboHold("Injected", BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, 500, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        sTriggered = 0;
+        {
+            ButtonComboModule::InputInjection injection(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+            CHECK_ERROR(injection.GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(GetMask() == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+
+            const ButtonComboModule_InputSample script[] = {
+                    {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, .sampleTime = OSMillisecondsToTicks(0)},
+                    {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, .sampleTime = OSMillisecondsToTicks(250)},
+                    {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, .sampleTime = OSMillisecondsToTicks(500)},
+                    {.controller = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .buttons = NONE, .sampleTime = OSMillisecondsToTicks(550)},
+            };
+            CHECK_ERROR(injection.Inject(script), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(sTriggered == 1);
+
+            // The real input of the masked controller doesn't interrupt the injected hold.
+            CHECK_ERROR(injection.Inject(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(600)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, OSMillisecondsToTicks(800)) == 0);
+            CHECK_ERROR(injection.Inject(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(1100)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(sTriggered == 2);
+            CHECK_ERROR(injection.Inject(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, OSMillisecondsToTicks(1150)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+            // Other controllers still use the real input.
+            CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(1200)) == 0);
+            CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(1700)) == 1);
+            CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, NONE, OSMillisecondsToTicks(1750)) == 0);
+        }
+        CHECK(GetMask() == BUTTON_COMBO_MODULE_CONTROLLER_NONE);
+
+        // The real input is evaluated again after the injection has ended.
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(2000)) == 0);
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_B, OSMillisecondsToTicks(2500)) == 1);
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, OSMillisecondsToTicks(2550)) == 0);
+    }
+
+    void TestRestoresPreviousMask() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Restore", BCMPAD_BUTTON_X, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        // E.g. another client injects input for WPAD_0 while this one runs a script.
+        CHECK_ERROR(ButtonComboModule_SetRealInputMask(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        {
+            ButtonComboModule::InputInjection outer(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+            CHECK_ERROR(outer.GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(GetMask() == (BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0));
+            {
+                ButtonComboModule::InputInjection inner(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1);
+                CHECK_ERROR(inner.GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+                CHECK(GetMask() == (BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1));
+            }
+            CHECK(GetMask() == (BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0));
+            CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_X, OSMillisecondsToTicks(3000)) == 0);
+        }
+        CHECK(GetMask() == BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0);
+
+        sTriggered = 0;
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, BCMPAD_BUTTON_X, OSMillisecondsToTicks(3100)) == 0);
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, OSMillisecondsToTicks(3100)) == 0);
+        CHECK(FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_X, OSMillisecondsToTicks(3200)) == 1);
+        CHECK(sTriggered == 1);
+
+        // Masking no controllers leaves the mask alone.
+        {
+            ButtonComboModule::InputInjection injection(BUTTON_COMBO_MODULE_CONTROLLER_NONE);
+            CHECK_ERROR(injection.GetError(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK_ERROR(ButtonComboModule_SetRealInputMask(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_2), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        }
+        CHECK(GetMask() == BUTTON_COMBO_MODULE_CONTROLLER_WPAD_2);
+        CHECK_ERROR(ButtonComboModule_SetRealInputMask(BUTTON_COMBO_MODULE_CONTROLLER_NONE), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestArguments() {
+        CHECK_ERROR(ButtonComboModule_GetRealInputMask(nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+
+    void TestVersion1() {
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        auto mask = BUTTON_COMBO_MODULE_CONTROLLER_NONE;
+        CHECK_ERROR(ButtonComboModule_GetRealInputMask(&mask), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        ButtonComboModule::InputInjection injection(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK_ERROR(injection.GetError(), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(injection.Inject(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A, 0), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestScriptedHold();
+    TestRestoresPreviousMask();
+    TestArguments();
+    TestVersion1();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("InputInjection");
+}
\ No newline at end of file
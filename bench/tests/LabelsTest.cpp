@@ -0,0 +1,137 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <string>
+#include <string_view>
+
+/**
+ * Passes labels that are not NUL-terminated to the C++ factories and UpdateLabel, and reads them back without copying
+ * and through buffers that are exactly as large as GetButtonComboLabelLength says.
+ */
+
+namespace {
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    // Reads the label back through every getter and compares it with the expected text.
+    void CheckLabel(const ButtonComboModule::ButtonCombo &combo, const std::string_view expected) {
+        std::string_view label;
+        CHECK_ERROR(combo.GetLabel(label), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(label == expected);
+        CHECK(label.data()[label.size()] == '\0');
+
+        uint32_t length = 0;
+        CHECK_ERROR(combo.GetLabelLength(length), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(length == expected.size());
+
+        // A buffer of length + 1 bytes holds the whole label.
+        std::string buffer(length + 1, 'x');
+        ButtonComboModule_MetaOptionsOut meta = {.labelBuffer = buffer.data(), .labelBufferLength = length + 1};
+        CHECK_ERROR(ButtonComboModule_GetButtonComboMeta(combo.getHandle(), &meta), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(std::string_view(buffer.c_str()) == expected);
+
+        // One byte less truncates it.
+        if (length > 0) {
+            meta.labelBufferLength = length;
+            CHECK_ERROR(ButtonComboModule_GetButtonComboMeta(combo.getHandle(), &meta), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CHECK(std::string_view(buffer.c_str()) == expected.substr(0, length - 1));
+        }
+    }
+
+    void TestNonTerminated() {
+        // Only the middle part is the label, the module must never see the text around it.
+        constexpr std::string_view text = "prefix|Screenshot|suffix";
+        const auto label                = text.substr(7, 10);
+
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown(label, BCMPAD_BUTTON_A, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        CheckLabel(*combo, "Screenshot");
+
+        CHECK_ERROR(combo->UpdateLabel(text.substr(0, 6)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CheckLabel(*combo, "prefix");
+
+        CHECK_ERROR(combo->UpdateLabel({}), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CheckLabel(*combo, "");
+    }
+
+    void TestLongLabel() {
+        // Labels with 64 characters or more take the heap path of LabelString.
+        for (const uint32_t size : {63u, 64u, 300u}) {
+            std::string text(size + 1, '?');
+            for (uint32_t i = 0; i < size; i++) {
+                text[i] = static_cast<char>('a' + i % 26);
+            }
+            const auto label = std::string_view(text).substr(0, size);
+
+            ButtonComboModule_ComboStatus status = {};
+            ButtonComboModule_Error error        = {};
+            auto combo                           = ButtonComboModule::CreateComboHold(label, BCMPAD_BUTTON_B, 500, OnCombo, nullptr, status, error);
+            CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            if (!combo) {
+                continue;
+            }
+            CheckLabel(*combo, label);
+
+            CHECK_ERROR(combo->UpdateLabel(label.substr(1)), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+            CheckLabel(*combo, label.substr(1));
+        }
+    }
+
+    void TestArguments() {
+        const char *label = nullptr;
+        uint32_t length   = 0;
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabel({}, &label, &length), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabelLength({}, &length), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Arguments", BCMPAD_BUTTON_X, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabel(combo->getHandle(), nullptr, &length), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabel(combo->getHandle(), &label, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabelLength(combo->getHandle(), nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+
+    void TestVersion1() {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Version1", BCMPAD_BUTTON_Y, OnCombo, nullptr, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        const char *label = nullptr;
+        uint32_t length   = 0;
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabel(handle, &label, &length), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK_ERROR(ButtonComboModule_GetButtonComboLabelLength(handle, &length), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+
+        // The copying getter still works.
+        char buffer[16]                       = {};
+        ButtonComboModule_MetaOptionsOut meta = {.labelBuffer = buffer, .labelBufferLength = sizeof(buffer)};
+        CHECK_ERROR(ButtonComboModule_GetButtonComboMeta(handle, &meta), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(std::string_view(buffer) == "Version1");
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestNonTerminated();
+    TestLongLabel();
+    TestArguments();
+    TestVersion1();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Labels");
+}
\ No newline at end of file
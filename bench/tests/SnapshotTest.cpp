@@ -0,0 +1,163 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboSnapshot.h>
+#include <buttoncombo/api.h>
+
+#include <cstring>
+#include <vector>
+
+/**
+ * Copies the registered combos into a snapshot and iterates it with a ComboSnapshotView, which has to reject any
+ * header that would make it read outside of the buffer.
+ */
+
+namespace {
+    using ButtonComboModule::ComboSnapshotView;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    ButtonComboModule_SnapshotHeader &Header(std::vector<uint32_t> &buffer) {
+        return *reinterpret_cast<ButtonComboModule_SnapshotHeader *>(buffer.data());
+    }
+
+    uint32_t SizeInBytes(const std::vector<uint32_t> &buffer) {
+        return static_cast<uint32_t>(buffer.size() * sizeof(uint32_t));
+    }
+
+    void TestSnapshot() {
+        ButtonComboModule_ComboHandle press  = {};
+        ButtonComboModule_ComboHandle hold   = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Press", BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, OnCombo, nullptr, &press, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_AddButtonComboHoldEx("Hold", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, 500, OnCombo, nullptr, false, &hold, &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+
+        // Size query, then a buffer that is one word too small is left untouched.
+        uint32_t requiredSize = 0;
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(nullptr, 0, &requiredSize), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(requiredSize > sizeof(ButtonComboModule_SnapshotHeader) + 2 * sizeof(ButtonComboModule_SnapshotEntry));
+        std::vector<uint32_t> buffer((requiredSize + 3) / 4);
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(buffer.data(), requiredSize - 4, &requiredSize), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(Header(buffer).version == 0);
+        CHECK(!ComboSnapshotView(buffer).IsValid());
+
+        CHECK_ERROR(ButtonComboModule::GetComboSnapshot(buffer, requiredSize), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        const ComboSnapshotView view(buffer);
+        CHECK(view.IsValid());
+        CHECK(view.size() == 2);
+        if (view.size() == 2) {
+            CHECK(view[0]->handle == press);
+            CHECK(view[0].label == "Press");
+            CHECK(view[0]->type == BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN);
+            CHECK(view[0]->holdDurationInMs == 0);
+            CHECK(view[0]->status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+            CHECK(view[1]->handle == hold);
+            CHECK(view[1].label == "Hold");
+            CHECK(view[1]->type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD);
+            CHECK(view[1]->controllerMask == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+            CHECK(view[1]->combo == (BCMPAD_BUTTON_L | BCMPAD_BUTTON_R));
+            CHECK(view[1]->holdDurationInMs == 500);
+            CHECK(view[1]->status == BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT);
+        }
+
+        // The strings point into the string pool of the buffer, the owner is shared.
+        const auto &header = Header(buffer);
+        const auto *pool   = reinterpret_cast<const char *>(buffer.data()) + header.stringPoolOffset;
+        uint32_t count     = 0;
+        for (const auto &entry : view) {
+            CHECK(entry->labelOffset < header.stringPoolSize);
+            CHECK(entry.label.data() == pool + entry->labelOffset);
+            CHECK(entry.label.data() + entry.label.size() < pool + header.stringPoolSize);
+            CHECK(entry.owner == "FakeClient");
+            CHECK(entry.owner.data() == view[0].owner.data());
+            count++;
+        }
+        CHECK(count == 2);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(press), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(hold), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        // Empty snapshots are valid.
+        CHECK_ERROR(ButtonComboModule::GetComboSnapshot(buffer, requiredSize), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(ComboSnapshotView(buffer).IsValid());
+        CHECK(ComboSnapshotView(buffer).empty());
+    }
+
+    void TestValidation() {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Label", BCMPAD_BUTTON_A, OnCombo, nullptr, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        uint32_t requiredSize = 0;
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(nullptr, 0, &requiredSize), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        std::vector<uint32_t> snapshot((requiredSize + 3) / 4);
+        CHECK_ERROR(ButtonComboModule::GetComboSnapshot(snapshot, requiredSize), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        CHECK(!ComboSnapshotView().IsValid());
+        CHECK(!ComboSnapshotView(nullptr, SizeInBytes(snapshot)).IsValid());
+        CHECK(!ComboSnapshotView(snapshot.data(), sizeof(ButtonComboModule_SnapshotHeader) - 1).IsValid());
+        // The header is checked against the size that is passed, not the size of the allocation.
+        CHECK(!ComboSnapshotView(snapshot.data(), requiredSize - 1).IsValid());
+        CHECK(ComboSnapshotView(snapshot.data(), requiredSize).size() == 1);
+
+        // Every corrupted header field results in an empty view.
+        const auto check = [&](const auto &corrupt) {
+            auto buffer = snapshot;
+            corrupt(Header(buffer));
+            const ComboSnapshotView view(buffer);
+            CHECK(!view.IsValid());
+            CHECK(view.empty());
+            CHECK(view.begin() == view.end());
+        };
+        check([](auto &header) { header.version = BUTTON_COMBO_MODULE_SNAPSHOT_VERSION + 1; });
+        check([](auto &header) { header.headerSize = sizeof(ButtonComboModule_SnapshotHeader) - 4; });
+        check([](auto &header) { header.headerSize += 2; });
+        check([](auto &header) { header.headerSize = 0xFFFFFFF0; });
+        check([](auto &header) { header.entrySize = sizeof(ButtonComboModule_SnapshotEntry) - 4; });
+        check([](auto &header) { header.entrySize += 2; });
+        check([](auto &header) { header.entryCount = 0x40000000; });
+        check([](auto &header) { header.stringPoolOffset = 0xFFFFFFF0; });
+        check([](auto &header) { header.stringPoolSize = 0xFFFFFFF0; });
+        check([](auto &header) { header.stringPoolSize += 4; });
+
+        // Strings outside of the pool are empty, unterminated ones end at the pool.
+        auto buffer         = snapshot;
+        const auto &header  = Header(buffer);
+        auto *entry         = reinterpret_cast<ButtonComboModule_SnapshotEntry *>(reinterpret_cast<uint8_t *>(buffer.data()) + header.headerSize);
+        entry->labelOffset  = header.stringPoolSize;
+        entry->ownerOffset  = 0xFFFFFFFF;
+        CHECK(ComboSnapshotView(buffer)[0].label.empty());
+        CHECK(ComboSnapshotView(buffer)[0].owner.empty());
+        entry->labelOffset = header.stringPoolSize - 1;
+        reinterpret_cast<char *>(buffer.data())[header.stringPoolOffset + header.stringPoolSize - 1] = 'x';
+        CHECK(ComboSnapshotView(buffer.data(), header.stringPoolOffset + header.stringPoolSize)[0].label == "x");
+    }
+
+    void TestArguments() {
+        uint32_t buffer[16]   = {};
+        uint32_t requiredSize = 0;
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(buffer, sizeof(buffer), nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(nullptr, sizeof(buffer), &requiredSize), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetComboSnapshot(reinterpret_cast<uint8_t *>(buffer) + 2, sizeof(buffer) - 4, &requiredSize), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestSnapshot();
+    TestValidation();
+    TestArguments();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Modules with API version 1 don't have the export.
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    uint32_t requiredSize = 0;
+    CHECK_ERROR(ButtonComboModule_GetComboSnapshot(nullptr, 0, &requiredSize), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Snapshot");
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+/**
+ * Counts the registered combos and dispatched callbacks, checks them against the callback budget and formats the
+ * statistics into buffers of any size.
+ */
+
+namespace {
+    std::chrono::milliseconds sCallbackDuration = {};
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        std::this_thread::sleep_for(sCallbackDuration);
+    }
+
+    ButtonComboModule_Stats GetStats() {
+        ButtonComboModule_Stats stats = {};
+        CHECK_ERROR(ButtonComboModule::GetStats(stats), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(stats.version == BUTTON_COMBO_MODULE_STATS_VERSION);
+        return stats;
+    }
+
+    bool Contains(const char *text, const char *part) {
+        return strstr(text, part) != nullptr;
+    }
+
+    void TestCombos() {
+        const auto before = GetStats();
+        CHECK(before.comboMemoryInBytes == 0);
+        CHECK(before.labelMemoryInBytes == 0);
+
+        ButtonComboModule_ComboHandle handles[2] = {};
+        ButtonComboModule_ComboStatus status     = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownEx("Press", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A, OnCombo, nullptr, false, &handles[0], &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_AddButtonComboHoldEx("Observer", BUTTON_COMBO_MODULE_CONTROLLER_ALL, BCMPAD_BUTTON_B, 100, OnCombo, nullptr, true, &handles[1], &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        const auto stats = GetStats();
+        CHECK(stats.combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN] == 1);
+        CHECK(stats.combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER] == 1);
+        CHECK(stats.combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD] == 0);
+        // Indexed by the bit of the controller, VPAD_0 is the first and WPAD_6 the last one.
+        CHECK(stats.combosByController[0] == 2);
+        CHECK(stats.combosByController[2] == 1);
+        CHECK(stats.combosByController[BUTTON_COMBO_MODULE_CONTROLLER_COUNT - 1] == 1);
+        CHECK(stats.comboMemoryInBytes > 0);
+        CHECK(stats.labelMemoryInBytes >= strlen("Press") + strlen("Observer"));
+
+        // Every callback is counted.
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        CHECK(GetStats().callbacksDispatched == stats.callbacksDispatched + 2);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombos(handles, 2), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(GetStats().comboMemoryInBytes == 0);
+    }
+
+    void TestCallbackBudget() {
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("Slow", BCMPAD_BUTTON_A, OnCombo, nullptr, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+        CHECK_ERROR(ButtonComboModule_SetCallbackBudget(1000), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        const auto before = GetStats();
+        CHECK(before.callbackBudgetInUs == 1000);
+
+        // Fast callbacks are within the budget.
+        sCallbackDuration = std::chrono::milliseconds(0);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        CHECK(GetStats().callbacksOverBudget == before.callbacksOverBudget);
+
+        sCallbackDuration = std::chrono::milliseconds(3);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        const auto slow = GetStats();
+        CHECK(slow.callbacksDispatched == before.callbacksDispatched + 2);
+        CHECK(slow.callbacksOverBudget == before.callbacksOverBudget + 1);
+        // The frame includes the callback.
+        CHECK(slow.peakFrameEvalTimeInUs >= 3000);
+        CHECK(slow.avgFrameEvalTimeInUs <= slow.peakFrameEvalTimeInUs);
+
+        // 0 disables the check.
+        CHECK_ERROR(ButtonComboModule_SetCallbackBudget(0), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_A) == 1);
+        const auto disabled = GetStats();
+        CHECK(disabled.callbackBudgetInUs == 0);
+        CHECK(disabled.callbacksOverBudget == slow.callbacksOverBudget);
+        sCallbackDuration = std::chrono::milliseconds(0);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestFormat() {
+        ButtonComboModule_Stats stats                                    = {.version = BUTTON_COMBO_MODULE_STATS_VERSION};
+        stats.combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN]    = 3;
+        stats.combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER] = 1;
+        stats.combosByController[0]                                      = 4;
+        stats.comboMemoryInBytes                                         = 4000000000u;
+        stats.labelMemoryInBytes                                         = 12;
+        stats.avgFrameEvalTimeInUs                                       = 5;
+        stats.peakFrameEvalTimeInUs                                      = 4294967295u;
+        stats.callbacksDispatched                                        = 1099511627776ull;
+        stats.callbacksOverBudget                                        = 7;
+        stats.callbackBudgetInUs                                         = 1000;
+
+        char text[512]        = {};
+        const uint32_t length = ButtonComboModule::FormatStats(stats, text);
+        CHECK(length == strlen(text));
+        CHECK(Contains(text, "Combos: 4 ("));
+        CHECK(Contains(text, "hold observer: 1"));
+        CHECK(Contains(text, "press down: 3"));
+        CHECK(Contains(text, "VPAD_0: 4"));
+        CHECK(Contains(text, "4000000000 bytes combos, 12 bytes labels"));
+        CHECK(Contains(text, "avg 5 us, peak 4294967295 us"));
+        CHECK(Contains(text, "1099511627776 dispatched, 7 over budget (1000 us)"));
+
+        // Truncated text is NUL-terminated, the full length is returned anyway.
+        char small[16];
+        memset(small, 'x', sizeof(small));
+        CHECK(ButtonComboModule::FormatStats(stats, small) == length);
+        CHECK(strlen(small) == sizeof(small) - 1);
+        CHECK(std::string_view(text).starts_with(small));
+        CHECK(ButtonComboModule::FormatStats(stats, {}) == length);
+        // Exactly one byte too small for the terminator.
+        const std::string_view full(text, length);
+        char exact[512];
+        CHECK(ButtonComboModule::FormatStats(stats, std::span(exact, length)) == length);
+        CHECK(full.substr(0, length - 1) == exact);
+    }
+
+    void TestArguments() {
+        ButtonComboModule_Stats stats = {};
+        CHECK_ERROR(ButtonComboModule_GetStats(nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_GetStats(&stats), BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION);
+        stats.version = BUTTON_COMBO_MODULE_STATS_VERSION + 1;
+        CHECK_ERROR(ButtonComboModule_GetStats(&stats), BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestCombos();
+    TestCallbackBudget();
+    TestFormat();
+    TestArguments();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Modules with API version 1 don't have the exports.
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    ButtonComboModule_Stats stats = {.version = BUTTON_COMBO_MODULE_STATS_VERSION};
+    CHECK_ERROR(ButtonComboModule_GetStats(&stats), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_SetCallbackBudget(1000), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Stats");
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <cmath>
+
+/**
+ * Checks the deadzone and hysteresis of the virtual stick direction buttons, both in the reference implementation and
+ * for combos that are fed stick positions through the fake module.
+ */
+
+namespace {
+    constexpr auto NONE = static_cast<ButtonComboModule_Buttons>(0);
+
+    ButtonComboModule_Buttons Left(const float x, const float y, const ButtonComboModule_Buttons previous = NONE,
+                                   const ButtonComboModule_StickDirectionOptions *options = nullptr) {
+        return ButtonComboModule_GetStickDirectionButtons(options, x, y, 0.0f, 0.0f, previous);
+    }
+
+    void TestDeadzone() {
+        CHECK(Left(0.0f, 0.0f) == NONE);
+        CHECK(Left(0.49f, 0.0f) == NONE);
+        CHECK(Left(0.5f, 0.0f) == BCMPAD_BUTTON_STICK_L_RIGHT);
+        CHECK(Left(-0.5f, 0.0f) == BCMPAD_BUTTON_STICK_L_LEFT);
+        CHECK(Left(0.0f, 1.0f) == BCMPAD_BUTTON_STICK_L_UP);
+        CHECK(Left(0.0f, -0.49f) == NONE);
+        CHECK(Left(0.0f, -1.0f) == BCMPAD_BUTTON_STICK_L_DOWN);
+
+        // The right stick uses its own bits.
+        CHECK(ButtonComboModule_GetStickDirectionButtons(nullptr, 0.0f, 0.0f, -0.8f, 0.8f, NONE) == (BCMPAD_BUTTON_STICK_R_LEFT | BCMPAD_BUTTON_STICK_R_UP));
+        CHECK(ButtonComboModule_GetStickDirectionButtons(nullptr, 0.8f, 0.0f, 0.0f, -0.8f, NONE) == (BCMPAD_BUTTON_STICK_L_RIGHT | BCMPAD_BUTTON_STICK_R_DOWN));
+    }
+
+    void TestDiagonals() {
+        // Each axis is checked on its own, a diagonal presses two directions once both axes pass the deadzone.
+        CHECK(Left(0.6f, 0.6f) == (BCMPAD_BUTTON_STICK_L_RIGHT | BCMPAD_BUTTON_STICK_L_UP));
+        CHECK(Left(-0.7f, -0.7f) == (BCMPAD_BUTTON_STICK_L_LEFT | BCMPAD_BUTTON_STICK_L_DOWN));
+        CHECK(Left(0.9f, -0.3f) == BCMPAD_BUTTON_STICK_L_RIGHT);
+        // A full diagonal of a round gate is about 0.707 on both axes.
+        CHECK(Left(std::sqrt(0.5f), std::sqrt(0.5f)) == (BCMPAD_BUTTON_STICK_L_RIGHT | BCMPAD_BUTTON_STICK_L_UP));
+    }
+
+    void TestHysteresis() {
+        // Pressed at 0.5, released below 0.4 with the defaults.
+        CHECK(Left(0.45f, 0.0f, NONE) == NONE);
+        CHECK(Left(0.45f, 0.0f, BCMPAD_BUTTON_STICK_L_RIGHT) == BCMPAD_BUTTON_STICK_L_RIGHT);
+        CHECK(Left(0.41f, 0.0f, BCMPAD_BUTTON_STICK_L_RIGHT) == BCMPAD_BUTTON_STICK_L_RIGHT);
+        CHECK(Left(0.39f, 0.0f, BCMPAD_BUTTON_STICK_L_RIGHT) == NONE);
+        CHECK(Left(-0.45f, 0.0f, BCMPAD_BUTTON_STICK_L_LEFT) == BCMPAD_BUTTON_STICK_L_LEFT);
+
+        // Only the previous state of the same direction counts.
+        CHECK(Left(0.45f, 0.0f, BCMPAD_BUTTON_STICK_L_LEFT) == NONE);
+        CHECK(Left(0.45f, 0.0f, BCMPAD_BUTTON_STICK_R_RIGHT) == NONE);
+        CHECK(Left(0.45f, 0.0f, BCMPAD_BUTTON_A) == NONE);
+        CHECK(Left(-0.6f, 0.0f, BCMPAD_BUTTON_STICK_L_RIGHT) == BCMPAD_BUTTON_STICK_L_LEFT);
+
+        const ButtonComboModule_StickDirectionOptions strict = {.deadzone = 0.8f, .hysteresis = 0.0f};
+        CHECK(Left(0.79f, 0.0f, NONE, &strict) == NONE);
+        CHECK(Left(0.8f, 0.0f, NONE, &strict) == BCMPAD_BUTTON_STICK_L_RIGHT);
+        CHECK(Left(0.79f, 0.0f, BCMPAD_BUTTON_STICK_L_RIGHT, &strict) == NONE);
+
+        const ButtonComboModule_StickDirectionOptions sticky = {.deadzone = 0.8f, .hysteresis = 0.6f};
+        CHECK(Left(0.0f, 0.3f, BCMPAD_BUTTON_STICK_L_UP, &sticky) == BCMPAD_BUTTON_STICK_L_UP);
+        CHECK(Left(0.0f, 0.1f, BCMPAD_BUTTON_STICK_L_UP, &sticky) == NONE);
+    }
+
+    uint32_t sTriggerCount = 0;
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+        sTriggerCount++;
+    }
+
+    // Feeds one sample with the given stick positions, returns the number of triggers.
+    uint32_t Sample(const FakeModule::StickPosition leftStick, const FakeModule::StickPosition rightStick = {}) {
+        return FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, leftStick, rightStick, FakeModule::NextSampleTime());
+    }
+
+    void TestPressDownCombo() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Stick", BCMPAD_BUTTON_STICK_R_UP, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        CHECK(Sample({}, {0.0f, 0.49f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.6f}) == 1);
+        // Wobbling around the deadzone doesn't trigger again.
+        CHECK(Sample({}, {0.0f, 0.45f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.55f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.42f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.6f}) == 0);
+        // Released below deadzone - hysteresis.
+        CHECK(Sample({}, {0.0f, 0.3f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.6f}) == 1);
+        CHECK(Sample({}, {}) == 0);
+        // The left stick has its own bits.
+        CHECK(Sample({0.0f, 1.0f}) == 0);
+        CHECK(Sample({}) == 0);
+
+        const ButtonComboModule_StickDirectionOptions strict = {.deadzone = 0.9f, .hysteresis = 0.0f};
+        CHECK_ERROR(combo->UpdateStickDirectionOptions(strict), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(Sample({}, {0.0f, 0.6f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.95f}) == 1);
+        CHECK(Sample({}, {0.0f, 0.85f}) == 0);
+        CHECK(Sample({}, {0.0f, 0.95f}) == 1);
+        CHECK(Sample({}, {}) == 0);
+    }
+
+    void TestDiagonalCombo() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Diagonal", BCMPAD_BUTTON_STICK_L_UP | BCMPAD_BUTTON_STICK_L_RIGHT, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        CHECK(Sample({0.7f, 0.0f}) == 0);
+        CHECK(Sample({0.7f, 0.7f}) == 1);
+        CHECK(Sample({0.7f, 0.45f}) == 0);
+        CHECK(Sample({0.7f, 0.0f}) == 0);
+        CHECK(Sample({0.0f, 0.7f}) == 0);
+        CHECK(Sample({0.7f, 0.7f}) == 1);
+        CHECK(Sample({}) == 0);
+    }
+
+    void TestHoldCombo() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboHold("Hold", BCMPAD_BUTTON_L | BCMPAD_BUTTON_STICK_L_DOWN, 100, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        sTriggerCount = 0;
+        // The stick rests in the hysteresis band for the whole hold.
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L, {0.0f, -0.6f}, {}, FakeModule::NextSampleTime());
+        for (uint32_t i = 0; i < 10; i++) {
+            FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L, {0.0f, -0.45f}, {}, FakeModule::NextSampleTime());
+        }
+        CHECK(sTriggerCount == 1);
+        CHECK(Sample({}) == 0);
+    }
+
+    void TestUpdateOptions() {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = ButtonComboModule::CreateComboPressDown("Options", BCMPAD_BUTTON_STICK_R_LEFT, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        if (!combo) {
+            return;
+        }
+        const auto handle = combo->getHandle();
+        for (const auto &options : {ButtonComboModule_StickDirectionOptions{.deadzone = 0.0f, .hysteresis = 0.0f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = 1.1f, .hysteresis = 0.0f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = -0.5f, .hysteresis = 0.0f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = 0.5f, .hysteresis = 0.5f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = 0.5f, .hysteresis = -0.1f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = NAN, .hysteresis = 0.0f},
+                                    ButtonComboModule_StickDirectionOptions{.deadzone = 0.5f, .hysteresis = NAN}}) {
+            CHECK_ERROR(ButtonComboModule_UpdateStickDirectionOptions(handle, &options), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        }
+        CHECK_ERROR(ButtonComboModule_UpdateStickDirectionOptions(handle, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        const ButtonComboModule_StickDirectionOptions full = {.deadzone = 1.0f, .hysteresis = 0.0f};
+        CHECK_ERROR(ButtonComboModule_UpdateStickDirectionOptions({}, &full), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_UpdateStickDirectionOptions(handle, &full), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        // The rejected options didn't change anything.
+        CHECK(Sample({}, {-0.99f, 0.0f}) == 0);
+        CHECK(Sample({}, {-1.0f, 0.0f}) == 1);
+        CHECK(Sample({}, {}) == 0);
+        combo.reset();
+
+        // The wrapper rejects the command before the handle is looked up.
+        CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        FakeModule::SetApiVersion(1);
+        CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_UpdateStickDirectionOptions(handle, &full), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    }
+
+    void TestVersion1() {
+        // Modules with API version 1 don't know the stick directions, so the wrappers reject them.
+        ButtonComboModule_ComboHandle handle = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("L+Up", BCMPAD_BUTTON_L | BCMPAD_BUTTON_STICK_R_UP, OnCombo, nullptr, &handle, &status),
+                    BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        CHECK(FakeModule::GetComboCount() == 0);
+
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDown("L", BCMPAD_BUTTON_L, OnCombo, nullptr, &handle, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_UpdateButtonCombo(handle, BCMPAD_BUTTON_L | BCMPAD_BUTTON_STICK_L_LEFT, &status), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+        // The combo keeps its buttons.
+        CHECK(FakeModule::Press(BCMPAD_BUTTON_L) == 1);
+        CHECK_ERROR(ButtonComboModule_UpdateButtonCombo(handle, BCMPAD_BUTTON_R, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(handle), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+} // namespace
+
+int main() {
+    TestDeadzone();
+    TestDiagonals();
+    TestHysteresis();
+
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestPressDownCombo();
+    TestDiagonalCombo();
+    TestHoldCombo();
+    TestUpdateOptions();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestVersion1();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("StickDirections");
+}
\ No newline at end of file
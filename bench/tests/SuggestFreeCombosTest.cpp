@@ -0,0 +1,139 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <array>
+#include <bit>
+
+/**
+ * Suggests free combos around registered ones, ranks them by chord size and truncates them at maxCount.
+ */
+
+namespace {
+    constexpr auto ALLOWED_BUTTONS = static_cast<ButtonComboModule_Buttons>(BCMPAD_BUTTON_L | BCMPAD_BUTTON_R | BCMPAD_BUTTON_X);
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    bool Contains(const ButtonComboModule_Buttons *combos, const uint32_t count, const uint32_t combo) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (combos[i] == combo) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Every suggestion is made of allowed buttons, unique and not smaller than the one before.
+    void CheckRanking(const ButtonComboModule_Buttons *combos, const uint32_t count, const uint32_t maxChordSize) {
+        for (uint32_t i = 0; i < count; i++) {
+            CHECK(combos[i] != 0);
+            CHECK((combos[i] & ~ALLOWED_BUTTONS) == 0);
+            CHECK(static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(combos[i]))) <= maxChordSize);
+            CHECK(!Contains(combos, i, combos[i]));
+            if (i > 0) {
+                CHECK(std::popcount(static_cast<uint32_t>(combos[i - 1])) <= std::popcount(static_cast<uint32_t>(combos[i])));
+            }
+        }
+    }
+
+    uint32_t Suggest(const ButtonComboModule_ControllerTypes controllerMask, const uint32_t maxChordSize, ButtonComboModule_Buttons *outCombos, const uint32_t maxCount) {
+        const ButtonComboModule_SuggestComboOptions options = {.controllerMask = controllerMask, .allowedButtons = ALLOWED_BUTTONS, .maxChordSize = maxChordSize};
+        uint32_t count                                      = maxCount + 1;
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&options, outCombos, maxCount, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count <= maxCount);
+        CheckRanking(outCombos, count, maxChordSize);
+        return count;
+    }
+
+    void TestNoCombos() {
+        ButtonComboModule_Buttons combos[8] = {};
+        // 3 single buttons, 3 pairs and the chord of all three.
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_ALL, 3, combos, 8) == 7);
+        CHECK(std::popcount(static_cast<uint32_t>(combos[2])) == 1);
+        CHECK(combos[6] == ALLOWED_BUTTONS);
+        // The chord size is capped by the number of allowed buttons.
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_ALL, 10, combos, 8) == 7);
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_ALL, 1, combos, 8) == 3);
+    }
+
+    void TestAroundCombo() {
+        ButtonComboModule_ComboHandle lr     = {};
+        ButtonComboModule_ComboStatus status = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownEx("L+R", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_L | BCMPAD_BUTTON_R, OnCombo, nullptr, false, &lr, &status),
+                    BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+        // L, R, L+R and L+R+X are blocked on the GamePad, the smaller X comes before the pairs.
+        ButtonComboModule_Buttons combos[8] = {};
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, 3, combos, 8) == 3);
+        CHECK(combos[0] == BCMPAD_BUTTON_X);
+        CHECK(Contains(combos, 3, BCMPAD_BUTTON_L | BCMPAD_BUTTON_X));
+        CHECK(Contains(combos, 3, BCMPAD_BUTTON_R | BCMPAD_BUTTON_X));
+        for (const auto combo : combos) {
+            const ButtonComboModule_ButtonComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .combo = combo};
+            if (combo != 0) {
+                CHECK_ERROR(ButtonComboModule_CheckComboAvailable(&options, &status), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+                CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+            }
+        }
+
+        // Other controllers are not affected, a mask that includes the GamePad is.
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, 3, combos, 8) == 7);
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0 | BUTTON_COMBO_MODULE_CONTROLLER_WPAD_0, 3, combos, 8) == 3);
+
+        // Truncated at maxCount, keeping the smallest.
+        ButtonComboModule_Buttons first[2] = {};
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, 3, first, 1) == 1);
+        CHECK(first[0] == BCMPAD_BUTTON_X);
+        CHECK(first[1] == 0);
+        CHECK(Suggest(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, 3, nullptr, 0) == 0);
+
+        std::array<ButtonComboModule_Buttons, 2> suggestions = {};
+        uint32_t count                                       = 0;
+        const ButtonComboModule_SuggestComboOptions options  = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .allowedButtons = ALLOWED_BUTTONS, .maxChordSize = 3};
+        CHECK_ERROR(ButtonComboModule::SuggestFreeCombos(options, suggestions, count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(count == 2);
+        CHECK(suggestions[0] == BCMPAD_BUTTON_X);
+
+        CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(lr), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    }
+
+    void TestArguments() {
+        ButtonComboModule_Buttons combo                     = {};
+        uint32_t count                                      = 0;
+        const ButtonComboModule_SuggestComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .allowedButtons = ALLOWED_BUTTONS, .maxChordSize = 2};
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(nullptr, &combo, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&options, nullptr, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&options, &combo, 1, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        auto invalid           = options;
+        invalid.controllerMask = static_cast<ButtonComboModule_ControllerTypes>(0);
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&invalid, &combo, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        invalid                = options;
+        invalid.allowedButtons = static_cast<ButtonComboModule_Buttons>(0);
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&invalid, &combo, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        invalid              = options;
+        invalid.maxChordSize = 0;
+        CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&invalid, &combo, 1, &count), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestNoCombos();
+    TestAroundCombo();
+    TestArguments();
+    CHECK(FakeModule::GetComboCount() == 0);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // Modules with API version 1 don't have the export.
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    const ButtonComboModule_SuggestComboOptions options = {.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, .allowedButtons = ALLOWED_BUTTONS, .maxChordSize = 2};
+    uint32_t count                                      = 0;
+    CHECK_ERROR(ButtonComboModule_SuggestFreeCombos(&options, nullptr, 0, &count), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("SuggestFreeCombos");
+}
\ No newline at end of file
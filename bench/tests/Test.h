@@ -0,0 +1,50 @@
+#pragma once
+
+#include <buttoncombo/api.h>
+
+#include <atomic>
+#include <cstdio>
+
+/**
+ * @file Test.h
+ * @brief Minimal check macros for the host tests. Every test is its own executable that returns non-zero if any
+ * check failed.
+ */
+namespace Test {
+    // Checks may fail on several threads at once.
+    inline std::atomic<uint32_t> sFailures = 0;
+
+    inline void Fail(const char *file, const int line, const char *expression) {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        sFailures++;
+    }
+
+    inline void FailError(const char *file, const int line, const char *expression, const ButtonComboModule_Error actual, const ButtonComboModule_Error expected) {
+        fprintf(stderr, "%s:%d: %s returned %s, expected %s\n", file, line, expression, ButtonComboModule_GetStatusStr(actual), ButtonComboModule_GetStatusStr(expected));
+        sFailures++;
+    }
+
+    inline int Result(const char *name) {
+        if (sFailures != 0) {
+            fprintf(stderr, "%s: %u check(s) failed\n", name, sFailures.load());
+            return 1;
+        }
+        printf("%s: passed\n", name);
+        return 0;
+    }
+} // namespace Test
+
+#define CHECK(expression)                                \
+    do {                                                 \
+        if (!(expression)) {                             \
+            Test::Fail(__FILE__, __LINE__, #expression); \
+        }                                                \
+    } while (0)
+
+#define CHECK_ERROR(expression, expected)                                       \
+    do {                                                                        \
+        const ButtonComboModule_Error _res = (expression);                      \
+        if (_res != (expected)) {                                               \
+            Test::FailError(__FILE__, __LINE__, #expression, _res, (expected)); \
+        }                                                                       \
+    } while (0)
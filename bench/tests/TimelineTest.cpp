@@ -0,0 +1,257 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/ButtonComboTimeline.h>
+#include <buttoncombo/api.h>
+
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Records a timeline against the fake module and sends the dump through ButtonComboModule_WriteTimelineDump,
+ * TimelineDumpView and WriteChromeTrace, in both byte orders and through tools/build/timeline_to_trace.
+ */
+
+namespace {
+    constexpr auto NONE = static_cast<ButtonComboModule_Buttons>(0);
+
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *) {
+    }
+
+    std::optional<ButtonComboModule::ButtonCombo> CreateCombo(const char *label, const ButtonComboModule_Buttons buttons, const uint32_t holdDurationInMs) {
+        ButtonComboModule_ComboStatus status = {};
+        ButtonComboModule_Error error        = {};
+        auto combo                           = holdDurationInMs != 0 ? ButtonComboModule::CreateComboHold(label, buttons, holdDurationInMs, OnCombo, nullptr, status, error)
+                                                                     : ButtonComboModule::CreateComboPressDown(label, buttons, OnCombo, nullptr, status, error);
+        CHECK_ERROR(error, BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+        return combo;
+    }
+
+    std::vector<uint64_t> WriteDump(const ButtonComboModule_TimelineRecorder &recorder) {
+        uint32_t size = 0;
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, nullptr, 0, &size), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        std::vector<uint64_t> dump((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        uint32_t written = 0;
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, dump.data(), size - 1, &written), BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL);
+        CHECK(written == size);
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, dump.data(), size, &written), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(written == size);
+        return dump;
+    }
+
+    std::vector<uint64_t> ByteSwap(const std::vector<uint64_t> &dump) {
+        auto swapped  = dump;
+        auto *data    = reinterpret_cast<uint8_t *>(swapped.data());
+        auto *header  = reinterpret_cast<ButtonComboModule_TimelineDumpHeader *>(data);
+        const auto *h = reinterpret_cast<const ButtonComboModule_TimelineDumpHeader *>(dump.data());
+        for (uint32_t i = 0; i < h->eventCount; i++) {
+            auto *event          = reinterpret_cast<ButtonComboModule_TimelineDumpEvent *>(data + h->headerSize + i * h->eventSize);
+            event->sampleTime    = static_cast<int64_t>(__builtin_bswap64(static_cast<uint64_t>(event->sampleTime)));
+            event->comboIndex    = __builtin_bswap32(event->comboIndex);
+            event->controller    = __builtin_bswap32(event->controller);
+            event->previousState = __builtin_bswap32(event->previousState);
+            event->state         = __builtin_bswap32(event->state);
+            event->heldForInMs   = __builtin_bswap32(event->heldForInMs);
+        }
+        for (auto *field = reinterpret_cast<uint32_t *>(header); field < reinterpret_cast<uint32_t *>(header + 1); field++) {
+            *field = __builtin_bswap32(*field);
+        }
+        return swapped;
+    }
+
+    std::string ToChromeTrace(const std::vector<uint64_t> &dump) {
+        std::string json;
+        const ButtonComboModule::TimelineDumpView view(dump.data(), static_cast<uint32_t>(dump.size() * sizeof(uint64_t)));
+        CHECK(ButtonComboModule::WriteChromeTrace(view, [&json](const std::string_view str) { json += str; }));
+        return json;
+    }
+
+    bool WriteFile(const std::string &path, const void *data, const size_t size) {
+        FILE *file = fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        const bool result = fwrite(data, 1, size, file) == size;
+        fclose(file);
+        return result;
+    }
+
+    std::string ReadFile(const std::string &path) {
+        std::string content;
+        if (FILE *file = fopen(path.c_str(), "rb"); file != nullptr) {
+            char chunk[4096];
+            size_t read;
+            while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+                content.append(chunk, read);
+            }
+            fclose(file);
+        }
+        return content;
+    }
+
+    int RunTool(const std::string &input, const std::string &output) {
+        const std::string command = "\"" TIMELINE_TO_TRACE "\" \"" + input + "\" \"" + output + "\" 2>/dev/null";
+        return system(command.c_str());
+    }
+
+    void CheckView(const ButtonComboModule::TimelineDumpView &view, const ButtonComboModule_TimelineRecorder &recorder, const std::vector<std::string_view> &labels) {
+        CHECK(view.IsValid());
+        CHECK(view.GetEventCount() == recorder.totalCount);
+        CHECK(view.GetDroppedCount() == 0);
+        CHECK(view.GetComboCount() == labels.size());
+        CHECK(view.GetTicksPerSecond() == OSMillisecondsToTicks(1000));
+        for (uint32_t i = 0; i < labels.size(); i++) {
+            CHECK(view.GetComboLabel(i) == labels[i]);
+        }
+        CHECK(view.GetComboLabel(static_cast<uint32_t>(labels.size())).empty());
+        for (uint32_t i = 0; i < view.GetEventCount() && i < recorder.totalCount; i++) {
+            const auto event = view.GetEvent(i);
+            CHECK(event.sampleTime == recorder.events[i].sampleTime);
+            CHECK(event.controller == recorder.events[i].controller);
+            CHECK(event.previousState == recorder.events[i].previousState);
+            CHECK(event.state == recorder.events[i].state);
+            CHECK(event.heldForInMs == recorder.events[i].heldForInMs);
+            // Events of the same combo share an index.
+            CHECK((view.GetEvent(0).comboIndex == event.comboIndex) == (recorder.events[0].handle == recorder.events[i].handle));
+        }
+    }
+
+    void TestRoundTrip() {
+        auto hold    = CreateCombo("Hold \"quoted\"", BCMPAD_BUTTON_A, 500);
+        auto press   = CreateCombo("Press", BCMPAD_BUTTON_B, 0);
+        auto removed = CreateCombo("Removed", BCMPAD_BUTTON_X, 0);
+        if (!hold || !press || !removed) {
+            return;
+        }
+
+        ButtonComboModule_TimelineEvent events[64]  = {};
+        ButtonComboModule_TimelineRecorder recorder = {.events = events, .capacity = 64};
+        CHECK_ERROR(ButtonComboModule_StartTimelineRecording(&recorder), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(recorder.recording != 0);
+
+        // The press down combo fires first, so it gets the first index.
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1, BCMPAD_BUTTON_B, OSMillisecondsToTicks(0));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A, OSMillisecondsToTicks(100));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A | BCMPAD_BUTTON_X, OSMillisecondsToTicks(700));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, NONE, OSMillisecondsToTicks(800));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_WPAD_1, NONE, OSMillisecondsToTicks(900));
+        CHECK(recorder.totalCount == 10);
+
+        // The ring is still written to.
+        uint32_t size = 0;
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, nullptr, 0, &size), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_StopTimelineRecording(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(recorder.recording == 0);
+        removed.reset();
+
+        const auto dump                            = WriteDump(recorder);
+        const std::vector<std::string_view> labels = {"Press", "Hold \"quoted\"", ""};
+        CheckView(ButtonComboModule::TimelineDumpView(dump.data(), static_cast<uint32_t>(dump.size() * sizeof(uint64_t))), recorder, labels);
+
+        const auto swapped = ByteSwap(dump);
+        CHECK(swapped != dump);
+        CheckView(ButtonComboModule::TimelineDumpView(swapped.data(), static_cast<uint32_t>(swapped.size() * sizeof(uint64_t))), recorder, labels);
+
+        const auto json = ToChromeTrace(dump);
+        CHECK(json == ToChromeTrace(swapped));
+        CHECK(json.find(R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"Press"}})") != std::string::npos);
+        CHECK(json.find(R"({"name":"process_name","ph":"M","pid":2,"args":{"name":"Hold \"quoted\""}})") != std::string::npos);
+        CHECK(json.find(R"({"name":"process_name","ph":"M","pid":3,"args":{"name":"<unknown>"}})") != std::string::npos);
+        CHECK(json.find(R"({"name":"ARMING","ph":"B","pid":2,"tid":0,"ts":100000.000,"args":{"heldForInMs":0}})") != std::string::npos);
+        CHECK(json.find(R"({"name":"ARMING","ph":"E","pid":2,"tid":0,"ts":700000.000})") != std::string::npos);
+        CHECK(json.find(R"({"name":"FIRED","ph":"i","s":"t","pid":2,"tid":0,"ts":700000.000,"args":{"heldForInMs":600}})") != std::string::npos);
+        CHECK(json.find(R"({"name":"HELD","ph":"E","pid":1,"tid":3,"ts":900000.000})") != std::string::npos);
+
+        // The host tool writes the same JSON for either byte order and rejects anything else.
+        const std::string dir = TIMELINE_TEST_DIR;
+        for (const auto *input : {&dump, &swapped}) {
+            CHECK(WriteFile(dir + "/timeline.bin", input->data(), input->size() * sizeof(uint64_t)));
+            CHECK(RunTool(dir + "/timeline.bin", dir + "/timeline.json") == 0);
+            CHECK(ReadFile(dir + "/timeline.json") == json);
+        }
+        CHECK(WriteFile(dir + "/timeline.bin", json.data(), json.size()));
+        CHECK(RunTool(dir + "/timeline.bin", dir + "/timeline.json") != 0);
+        CHECK(RunTool(dir + "/missing.bin", dir + "/timeline.json") != 0);
+
+        CHECK(!ButtonComboModule::WriteChromeTrace(ButtonComboModule::TimelineDumpView(json.data(), static_cast<uint32_t>(json.size())), [](std::string_view) {}));
+    }
+
+    void TestWrapAround() {
+        std::vector<std::optional<ButtonComboModule::ButtonCombo>> combos;
+        constexpr ButtonComboModule_Buttons buttons[] = {BCMPAD_BUTTON_A, BCMPAD_BUTTON_B, BCMPAD_BUTTON_X, BCMPAD_BUTTON_Y, BCMPAD_BUTTON_L, BCMPAD_BUTTON_R};
+        for (const auto button : buttons) {
+            combos.push_back(CreateCombo("Wrap", button, 0));
+        }
+
+        // Each press is recorded as FIRED, HELD and IDLE, only the last 16 events are kept.
+        ButtonComboModule_TimelineEvent events[16]  = {};
+        ButtonComboModule_TimelineRecorder recorder = {.events = events, .capacity = 16};
+        CHECK_ERROR(ButtonComboModule_StartTimelineRecording(&recorder), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        OSTime time = 0;
+        for (uint32_t round = 0; round < 4; round++) {
+            for (const auto button : buttons) {
+                FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_1, button, time += OSMillisecondsToTicks(10));
+                FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_1, NONE, time += OSMillisecondsToTicks(10));
+            }
+        }
+        CHECK_ERROR(ButtonComboModule_StopTimelineRecording(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(recorder.totalCount == 4 * 6 * 3);
+
+        const auto dump = WriteDump(recorder);
+        const ButtonComboModule::TimelineDumpView view(dump.data(), static_cast<uint32_t>(dump.size() * sizeof(uint64_t)));
+        CHECK(view.IsValid());
+        CHECK(view.GetEventCount() == 16);
+        CHECK(view.GetDroppedCount() == 4 * 6 * 3 - 16);
+        CHECK(view.GetComboCount() == 6);
+
+        // Oldest first, combos are indexed in the order they show up.
+        uint32_t nextIndex = 0;
+        for (uint32_t i = 0; i < view.GetEventCount(); i++) {
+            const auto event = view.GetEvent(i);
+            const auto &raw  = events[(recorder.totalCount + i) % recorder.capacity];
+            CHECK(event.sampleTime == raw.sampleTime);
+            CHECK(event.state == raw.state);
+            CHECK(event.comboIndex <= nextIndex);
+            if (event.comboIndex == nextIndex) {
+                nextIndex++;
+            }
+            if (i > 0) {
+                CHECK(event.sampleTime >= view.GetEvent(i - 1).sampleTime);
+                const auto &previous = events[(recorder.totalCount + i - 1) % recorder.capacity];
+                CHECK((event.comboIndex == view.GetEvent(i - 1).comboIndex) == (raw.handle == previous.handle));
+            }
+        }
+        CHECK(nextIndex == 6);
+    }
+
+    void TestArguments() {
+        ButtonComboModule_TimelineRecorder recorder = {};
+        uint32_t size                               = 0;
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(nullptr, nullptr, 0, &size), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, nullptr, 0, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, nullptr, 16, &size), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+        alignas(8) uint8_t buffer[sizeof(ButtonComboModule_TimelineDumpHeader) + 1];
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, buffer + 1, sizeof(buffer) - 1, &size), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        // An empty recording is still a valid dump.
+        CHECK_ERROR(ButtonComboModule_WriteTimelineDump(&recorder, buffer, sizeof(buffer), &size), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(size == sizeof(ButtonComboModule_TimelineDumpHeader));
+        const ButtonComboModule::TimelineDumpView view(buffer, size);
+        CHECK(view.IsValid());
+        CHECK(view.GetEventCount() == 0);
+        CHECK(view.GetComboCount() == 0);
+        CHECK(!ButtonComboModule::TimelineDumpView(buffer, size - 1).IsValid());
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestRoundTrip();
+    TestWrapAround();
+    TestArguments();
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("Timeline");
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "../host/FakeModule.h"
+#include "Test.h"
+
+#include <buttoncombo/api.h>
+
+#include <cstring>
+
+/**
+ * The cooldown and debounce time of a combo live in ButtonComboModule_TriggerFilter, ButtonComboModule_ButtonComboInfoEx
+ * keeps its original layout. Filtered triggers are suppressed before dispatch and counted.
+ */
+
+namespace {
+    void OnCombo(ButtonComboModule_ControllerTypes, ButtonComboModule_ComboHandle, void *context) {
+        (*static_cast<uint32_t *>(context))++;
+    }
+
+    // Presses the buttons `pressAtMs` after `base` and releases them `releaseAtMs` after `base`.
+    void Tap(const ButtonComboModule_Buttons buttons, const OSTime base, const uint32_t pressAtMs, const uint32_t releaseAtMs) {
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, buttons, base + OSMillisecondsToTicks(pressAtMs));
+        FakeModule::InjectInput(BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, static_cast<ButtonComboModule_Buttons>(0), base + OSMillisecondsToTicks(releaseAtMs));
+    }
+
+    uint32_t GetSuppressed(const ButtonComboModule_ComboHandle handle) {
+        uint32_t count = 0xAAAAAAAA;
+        CHECK_ERROR(ButtonComboModule_GetSuppressedTriggerCount(handle, &count), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        return count;
+    }
+
+    void TestInfoExLayout(const ButtonComboModule_ComboHandle handle) {
+        struct {
+            ButtonComboModule_ButtonComboInfoEx info;
+            uint32_t guard;
+        } out;
+        memset(&out, 0xAA, sizeof(out));
+        CHECK_ERROR(ButtonComboModule_GetButtonComboInfoEx(handle, &out.info), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(out.info.type == BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN);
+        CHECK(out.info.basicCombo.combo == BCMPAD_BUTTON_A);
+        CHECK(out.info.basicCombo.controllerMask == BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0);
+        CHECK(out.info.optionalHoldForXMs == 0);
+        CHECK(out.guard == 0xAAAAAAAA);
+    }
+
+    void TestFilterRoundTrip(const ButtonComboModule_ComboHandle handle) {
+        ButtonComboModule_TriggerFilter filter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION};
+        CHECK_ERROR(ButtonComboModule_GetTriggerFilter(handle, &filter), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(filter.cooldownInMs == 100);
+        CHECK(filter.debounceInMs == 0);
+
+        filter.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION + 1;
+        CHECK_ERROR(ButtonComboModule_GetTriggerFilter(handle, &filter), BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION);
+        CHECK_ERROR(ButtonComboModule_GetTriggerFilter(handle, nullptr), BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT);
+
+        ButtonComboModule_ComboOptions options               = {};
+        options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX;
+        options.callbackOptions                              = {.callback = OnCombo, .context = nullptr};
+        options.buttonComboOptions.type                      = BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER;
+        options.buttonComboOptions.basicCombo.combo          = BCMPAD_BUTTON_Y;
+        options.buttonComboOptions.basicCombo.controllerMask = BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0;
+        options.triggerFilter.version                        = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION + 1;
+        ButtonComboModule_ComboHandle rejected               = {};
+        CHECK_ERROR(ButtonComboModule_AddButtonCombo(&options, &rejected, nullptr), BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION);
+    }
+
+    // Cooldown of 100 ms: only presses at least 100 ms after the last dispatched trigger get through.
+    void TestCooldown(const ButtonComboModule_ComboHandle handle, const uint32_t &calls) {
+        const auto base = FakeModule::NextSampleTime();
+        Tap(BCMPAD_BUTTON_A, base, 0, 16);    // Dispatched
+        Tap(BCMPAD_BUTTON_A, base, 48, 64);   // Suppressed, 48 ms after the trigger
+        Tap(BCMPAD_BUTTON_A, base, 96, 112);  // Suppressed, 96 ms after the trigger
+        Tap(BCMPAD_BUTTON_A, base, 120, 136); // Dispatched, 120 ms after the trigger
+        Tap(BCMPAD_BUTTON_A, base, 160, 176); // Suppressed, measured from the second trigger
+        CHECK(calls == 2);
+        CHECK(GetSuppressed(handle) == 3);
+
+        // A suppressed trigger doesn't restart the cooldown.
+        Tap(BCMPAD_BUTTON_A, base, 220, 236);
+        CHECK(calls == 3);
+        CHECK(GetSuppressed(handle) == 3);
+    }
+
+    // Debounce of 40 ms: a release shorter than that doesn't end the press.
+    void TestDebounce(const ButtonComboModule_ComboHandle handle, const uint32_t &calls) {
+        const auto base = FakeModule::NextSampleTime() + OSMillisecondsToTicks(1000);
+        Tap(BCMPAD_BUTTON_B, base, 0, 16);    // Dispatched
+        Tap(BCMPAD_BUTTON_B, base, 32, 48);   // Suppressed, released for 16 ms
+        Tap(BCMPAD_BUTTON_B, base, 80, 96);   // Suppressed, released for 32 ms
+        Tap(BCMPAD_BUTTON_B, base, 140, 156); // Dispatched, released for 44 ms
+        Tap(BCMPAD_BUTTON_B, base, 300, 316); // Dispatched
+        CHECK(calls == 3);
+        CHECK(GetSuppressed(handle) == 2);
+
+        // Without a filter every press is dispatched, the counter is kept.
+        CHECK_ERROR(ButtonComboModule_UpdateTriggerFilter(handle, 0, 0), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        ButtonComboModule_TriggerFilter filter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION};
+        CHECK_ERROR(ButtonComboModule_GetTriggerFilter(handle, &filter), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+        CHECK(filter.cooldownInMs == 0);
+        CHECK(filter.debounceInMs == 0);
+        Tap(BCMPAD_BUTTON_B, base, 400, 416);
+        Tap(BCMPAD_BUTTON_B, base, 420, 436);
+        CHECK(calls == 5);
+        CHECK(GetSuppressed(handle) == 2);
+    }
+} // namespace
+
+int main() {
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    uint32_t cooldownCalls                 = 0;
+    uint32_t debounceCalls                 = 0;
+    ButtonComboModule_ComboHandle cooldown = {};
+    ButtonComboModule_ComboHandle debounce = {};
+    ButtonComboModule_ComboStatus status   = {};
+    CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownFiltered("Cooldown", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_A, 100, 0, OnCombo, &cooldownCalls, false, &cooldown, &status),
+                BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+    CHECK_ERROR(ButtonComboModule_AddButtonComboPressDownFiltered("Debounce", BUTTON_COMBO_MODULE_CONTROLLER_VPAD_0, BCMPAD_BUTTON_B, 0, 40, OnCombo, &debounceCalls, false, &debounce, &status),
+                BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK(status == BUTTON_COMBO_MODULE_COMBO_STATUS_VALID);
+
+    TestInfoExLayout(cooldown);
+    TestFilterRoundTrip(cooldown);
+    TestCooldown(cooldown, cooldownCalls);
+    TestDebounce(debounce, debounceCalls);
+    CHECK(cooldownCalls == 3);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+
+    // The combos are still registered, they have been added through the C API.
+    FakeModule::SetApiVersion(1);
+    CHECK_ERROR(ButtonComboModule_InitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    TestInfoExLayout(cooldown);
+    ButtonComboModule_TriggerFilter filter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION};
+    CHECK_ERROR(ButtonComboModule_GetTriggerFilter(cooldown, &filter), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_UpdateTriggerFilter(cooldown, 0, 0), BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND);
+    CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(cooldown), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK_ERROR(ButtonComboModule_RemoveButtonCombo(debounce), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    CHECK_ERROR(ButtonComboModule_DeInitLibrary(), BUTTON_COMBO_MODULE_ERROR_SUCCESS);
+    return Test::Result("TriggerFilter");
+}
\ No newline at end of file
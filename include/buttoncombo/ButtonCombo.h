@@ -3,16 +3,30 @@
 #ifdef __cplusplus
 
 #include "defines.h"
+#include "expected.h"
+#include "inplace_vector.h"
+#include <algorithm>
 #include <optional>
+#include <string_view>
+
+#if !defined(BUTTONCOMBO_NO_EXCEPTIONS) && !defined(__cpp_exceptions)
+#define BUTTONCOMBO_NO_EXCEPTIONS
+#endif
 
 namespace ButtonComboModule {
 
+    class FrameExecutor;
+    class TriggerAwaiter;
+
     /**
      * @class ButtonCombo
      * @brief RAII Wrapper for a ButtonComboModule handle.
      *
      * Manages a single button combo. The combo is automatically unregistered via
      * @ref ButtonComboModule_RemoveButtonCombo when this object is destroyed.
+     *
+     * If the library is deinitialized while the object is still alive, the combo is released by
+     * @ref ButtonComboModule_DeInitLibrary and the object is detached (@ref getHandle returns a NULL handle).
      */
     class ButtonCombo {
     public:
@@ -22,11 +36,19 @@ namespace ButtonComboModule {
         static std::optional<ButtonCombo> Create(const ButtonComboModule_ComboOptions &options,
                                                  ButtonComboModule_ComboStatus &outStatus,
                                                  ButtonComboModule_Error &outError) noexcept;
+        /**
+         * @brief Internal factory (Non-throwing). Use `ButtonComboModule::TryCreate...` instead.
+         */
+        static expected<ButtonCombo, ButtonComboModule_Error> TryCreate(const ButtonComboModule_ComboOptions &options,
+                                                                        ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
         /**
          * @brief Internal factory (Throwing).
          */
         static ButtonCombo Create(const ButtonComboModule_ComboOptions &options,
                                   ButtonComboModule_ComboStatus &outStatus);
+#endif
 
         /**
          * @brief Destructor. Calls @ref ButtonComboModule_RemoveButtonCombo.
@@ -44,6 +66,11 @@ namespace ButtonComboModule {
          */
         [[nodiscard]] ButtonComboModule_ComboHandle getHandle() const;
 
+        /**
+         * @brief Returns the number of ButtonCombo objects that currently own a combo. Useful for leak checks.
+         */
+        [[nodiscard]] static uint32_t GetLiveCount();
+
         /**
          * @brief Retrieves status.
          * @sa ButtonComboModule_GetButtonComboStatus
@@ -90,6 +117,26 @@ namespace ButtonComboModule {
          */
         [[nodiscard]] ButtonComboModule_Error GetButtonComboMeta(ButtonComboModule_MetaOptionsOut &outOptions) const;
 
+        /**
+         * @brief Updates the label. Unlike @ref UpdateButtonComboMeta, `label` doesn't need to be NUL-terminated.
+         * @details Labels shorter than 64 characters don't allocate.
+         * @sa ButtonComboModule_UpdateButtonComboMeta
+         */
+        [[nodiscard]] ButtonComboModule_Error UpdateLabel(std::string_view label) const;
+
+        /**
+         * @brief Retrieves the label without copying it.
+         * @details `outLabel` is valid until the label is updated or the combo is removed.
+         * @sa ButtonComboModule_GetButtonComboLabel
+         */
+        [[nodiscard]] ButtonComboModule_Error GetLabel(std::string_view &outLabel) const;
+
+        /**
+         * @brief Retrieves the length of the label.
+         * @sa ButtonComboModule_GetButtonComboLabelLength
+         */
+        [[nodiscard]] ButtonComboModule_Error GetLabelLength(uint32_t &outLength) const;
+
         /**
          * @brief Retrieves callback options.
          * @sa ButtonComboModule_GetButtonComboCallback
@@ -102,10 +149,192 @@ namespace ButtonComboModule {
          */
         ButtonComboModule_Error GetButtonComboInfoEx(ButtonComboModule_ButtonComboInfoEx &outOptions) const;
 
+        /**
+         * @brief Updates the cooldown and debounce time.
+         * @sa ButtonComboModule_UpdateTriggerFilter
+         */
+        [[nodiscard]] ButtonComboModule_Error UpdateTriggerFilter(uint32_t cooldownInMs, uint32_t debounceInMs) const;
+
+        /**
+         * @brief Retrieves the number of suppressed triggers.
+         * @sa ButtonComboModule_GetSuppressedTriggerCount
+         */
+        ButtonComboModule_Error GetSuppressedTriggerCount(uint32_t &outCount) const;
+
+        /**
+         * @brief Retrieves the cooldown and debounce time.
+         * @sa ButtonComboModule_GetTriggerFilter
+         */
+        ButtonComboModule_Error GetTriggerFilter(ButtonComboModule_TriggerFilter &outFilter) const;
+
+        /**
+         * @brief Replaces the expression and re-checks conflicts.
+         * @sa ButtonComboModule_UpdateComboExpression
+         */
+        [[nodiscard]] ButtonComboModule_Error UpdateComboExpression(const ButtonComboModule_ComboExpression &expression,
+                                                                    ButtonComboModule_ComboStatus &outStatus) const;
+
+        /**
+         * @brief Retrieves the expression.
+         * @sa ButtonComboModule_GetComboExpression
+         */
+        ButtonComboModule_Error GetComboExpression(ButtonComboModule_ComboExpression &outExpression) const;
+
+        /**
+         * @brief Updates the thresholds of the stick direction buttons.
+         * @sa ButtonComboModule_UpdateStickDirectionOptions
+         */
+        [[nodiscard]] ButtonComboModule_Error UpdateStickDirectionOptions(const ButtonComboModule_StickDirectionOptions &options) const;
+
+        /**
+         * @brief Lists the combos that block this combo, e.g. if its status is CONFLICT.
+         * @details Returns BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL if not all conflicts fit into `outConflicts`.
+         * @sa ButtonComboModule_GetButtonComboConflicts
+         */
+        template<size_t N>
+        ButtonComboModule_Error GetConflicts(inplace_vector<ButtonComboModule_ConflictInfo, N> &outConflicts) const;
+
+        /**
+         * @brief Excludes this combo from (or re-includes it in) the foreground lifecycle mode.
+         * @details Exempt combos keep running while the app is in the background. The setting is kept if the mode is
+         *          enabled later on, and works for combos in a ButtonComboGroup as well.
+         * @sa ButtonComboModule_SetForegroundLifecycleEnabled
+         * @sa ButtonComboModule_SetButtonComboSuspendExempt
+         */
+        ButtonComboModule_Error SetForegroundLifecycleExempt(bool exempt);
+
+        /**
+         * @brief Returns true if the combo has been excluded via @ref SetForegroundLifecycleExempt.
+         */
+        [[nodiscard]] bool IsForegroundLifecycleExempt() const;
+
+        /**
+         * @brief Waits for the next trigger of this combo. Use with `co_await`.
+         *
+         * While awaiting, the registered callback is replaced and restored once the combo has been triggered.
+         * The awaiting coroutine is resumed by `executor`, or by @ref FrameExecutor::Main if none is given.
+         * Include <buttoncombo/ButtonComboAsync.h> to use the returned awaiter. Requires C++20 coroutine support.
+         * Combos that use a @ref ButtonComboModule_ComboCallbackEx resume immediately with
+         * BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND. If the combo is released while awaiting, the coroutine is
+         * resumed by the executor with BUTTON_COMBO_MODULE_ERROR_ABORTED.
+         */
+        [[nodiscard]] TriggerAwaiter NextTrigger() const;
+        [[nodiscard]] TriggerAwaiter NextTrigger(FrameExecutor &executor) const;
+
     private:
+        friend class ComboRegistry;
+
         void ReleaseButtonComboHandle();
         explicit ButtonCombo(ButtonComboModule_ComboHandle handle);
         ButtonComboModule_ComboHandle mHandle = ButtonComboModule_ComboHandle(nullptr);
+
+        // Intrusive list of live combos, guarded by the ComboRegistry.
+        ButtonCombo *mPrev = nullptr;
+        ButtonCombo *mNext = nullptr;
+
+        // Mirrors the suspend exemption of the handle, moved together with it.
+        bool mLifecycleExempt = false;
     };
 } // namespace ButtonComboModule
+
+// The thin wrappers are defined inline over ButtonComboModule::detail, so they are a single call into the module.
+#include "api.h"
+
+namespace ButtonComboModule {
+    inline ButtonComboModule_ComboHandle ButtonCombo::getHandle() const {
+        return mHandle;
+    }
+
+    inline bool ButtonCombo::IsForegroundLifecycleExempt() const {
+        return mLifecycleExempt;
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetButtonComboStatus(ButtonComboModule_ComboStatus &outStatus) const {
+        return detail::ButtonComboModule_GetButtonComboStatus(mHandle, &outStatus);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateButtonComboMeta(const ButtonComboModule_MetaOptions &metaOptions) const {
+        return detail::ButtonComboModule_UpdateButtonComboMeta(mHandle, &metaOptions);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateButtonComboCallback(const ButtonComboModule_CallbackOptions &callbackOptions) const {
+        return detail::ButtonComboModule_UpdateButtonComboCallback(mHandle, &callbackOptions);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateControllerMask(const ButtonComboModule_ControllerTypes controllerMask,
+                                                                     ButtonComboModule_ComboStatus &outStatus) const {
+        return detail::ButtonComboModule_UpdateControllerMask(mHandle, controllerMask, &outStatus);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateButtonCombo(const ButtonComboModule_Buttons combo,
+                                                                  ButtonComboModule_ComboStatus &outStatus) const {
+        return detail::ButtonComboModule_UpdateButtonCombo(mHandle, combo, &outStatus);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateHoldDuration(const uint32_t holdDurationInFrames) const {
+        return detail::ButtonComboModule_UpdateHoldDuration(mHandle, holdDurationInFrames);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetButtonComboMeta(ButtonComboModule_MetaOptionsOut &outOptions) const {
+        return detail::ButtonComboModule_GetButtonComboMeta(mHandle, &outOptions);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetLabel(std::string_view &outLabel) const {
+        const char *label = nullptr;
+        uint32_t length   = 0;
+        const auto res    = detail::ButtonComboModule_GetButtonComboLabel(mHandle, &label, &length);
+        outLabel          = res == BUTTON_COMBO_MODULE_ERROR_SUCCESS ? std::string_view(label, length) : std::string_view();
+        return res;
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetLabelLength(uint32_t &outLength) const {
+        return detail::ButtonComboModule_GetButtonComboLabelLength(mHandle, &outLength);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetButtonComboCallback(ButtonComboModule_CallbackOptions &outOptions) const {
+        return detail::ButtonComboModule_GetButtonComboCallback(mHandle, &outOptions);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetButtonComboInfoEx(ButtonComboModule_ButtonComboInfoEx &outOptions) const {
+        return detail::ButtonComboModule_GetButtonComboInfoEx(mHandle, &outOptions);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateTriggerFilter(const uint32_t cooldownInMs, const uint32_t debounceInMs) const {
+        return detail::ButtonComboModule_UpdateTriggerFilter(mHandle, cooldownInMs, debounceInMs);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetSuppressedTriggerCount(uint32_t &outCount) const {
+        return detail::ButtonComboModule_GetSuppressedTriggerCount(mHandle, &outCount);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetTriggerFilter(ButtonComboModule_TriggerFilter &outFilter) const {
+        outFilter.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION;
+        return detail::ButtonComboModule_GetTriggerFilter(mHandle, &outFilter);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateComboExpression(const ButtonComboModule_ComboExpression &expression,
+                                                                      ButtonComboModule_ComboStatus &outStatus) const {
+        return detail::ButtonComboModule_UpdateComboExpression(mHandle, &expression, &outStatus);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::GetComboExpression(ButtonComboModule_ComboExpression &outExpression) const {
+        return detail::ButtonComboModule_GetComboExpression(mHandle, &outExpression);
+    }
+
+    inline ButtonComboModule_Error ButtonCombo::UpdateStickDirectionOptions(const ButtonComboModule_StickDirectionOptions &options) const {
+        return detail::ButtonComboModule_UpdateStickDirectionOptions(mHandle, &options);
+    }
+
+    template<size_t N>
+    ButtonComboModule_Error ButtonCombo::GetConflicts(inplace_vector<ButtonComboModule_ConflictInfo, N> &outConflicts) const {
+        uint32_t count = 0;
+        outConflicts.resize(N);
+        const auto res = detail::ButtonComboModule_GetButtonComboConflicts(mHandle, outConflicts.data(), N, &count);
+        outConflicts.resize(res == BUTTON_COMBO_MODULE_ERROR_SUCCESS ? std::min<size_t>(count, N) : 0);
+        if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS && count > N) {
+            return BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL;
+        }
+        return res;
+    }
+} // namespace ButtonComboModule
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#define BUTTONCOMBO_HAS_COROUTINES 1
+
+#include "ButtonCombo.h"
+#include "defines.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+
+namespace ButtonComboModule {
+
+    class FrameExecutor;
+    class PendingTriggers;
+
+    /**
+     * @class ExecutorNode
+     * @brief Intrusive queue node for awaiters that are resumed by a @ref FrameExecutor.
+     *
+     * Awaiters live inside the coroutine frame, so queueing them for resumption never allocates.
+     */
+    class ExecutorNode {
+        friend class FrameExecutor;
+
+    protected:
+        std::coroutine_handle<> mContinuation = nullptr;
+
+    private:
+        ExecutorNode *mNext = nullptr;
+    };
+
+    /**
+     * @class FrameExecutor
+     * @brief Minimal single-threaded executor that resumes suspended coroutines from a per-frame pump.
+     *
+     * Awaiters are posted from the thread that completes them (e.g. the module's input thread) and are resumed
+     * on the thread that calls @ref Pump, typically once per frame from the main loop.
+     */
+    class FrameExecutor {
+    public:
+        /**
+         * @brief Returns the default executor used by @ref ButtonCombo::NextTrigger and @ref DetectButtonComboAsync.
+         */
+        static FrameExecutor &Main();
+
+        FrameExecutor() = default;
+
+        FrameExecutor(const FrameExecutor &)            = delete;
+        FrameExecutor &operator=(const FrameExecutor &) = delete;
+
+        /**
+         * @brief Queues a node for resumption during the next @ref Pump. Thread-safe and lock-free.
+         */
+        void Post(ExecutorNode &node) noexcept;
+
+        /**
+         * @brief Resumes every coroutine that became ready since the last call.
+         *
+         * Must only be called from a single thread. Coroutines that suspend again while being resumed are
+         * picked up by the next call.
+         *
+         * @return Number of resumed coroutines.
+         */
+        uint32_t Pump() noexcept;
+
+    private:
+        std::atomic<ExecutorNode *> mReady = nullptr;
+    };
+
+    /**
+     * @brief Fire-and-forget coroutine type. The coroutine starts eagerly and frees its frame on completion.
+     */
+    struct Task {
+        struct promise_type {
+            Task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    struct TriggerResult {
+        ButtonComboModule_Error error;
+        ButtonComboModule_ControllerTypes triggeredBy;
+    };
+
+    struct DetectResult {
+        ButtonComboModule_Error error;
+        ButtonComboModule_Buttons buttons;
+    };
+
+    /**
+     * @class TriggerAwaiter
+     * @brief Awaiter returned by @ref ButtonCombo::NextTrigger.
+     *
+     * While suspended, the combo callback is temporarily redirected to this awaiter. The original callback is
+     * restored before the coroutine continues. Triggers only reach the awaiter while it's pending, a trigger that the
+     * module dispatches after the coroutine has been resumed is ignored without touching the coroutine frame.
+     * If the combo is released (or the library is deinitialized) while the coroutine is suspended, it's resumed by the
+     * executor with BUTTON_COMBO_MODULE_ERROR_ABORTED.
+     */
+    class TriggerAwaiter : ExecutorNode {
+    public:
+        TriggerAwaiter(ButtonComboModule_ComboHandle handle, FrameExecutor &executor) noexcept;
+
+        TriggerAwaiter(const TriggerAwaiter &)            = delete;
+        TriggerAwaiter &operator=(const TriggerAwaiter &) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+        TriggerResult await_resume() noexcept;
+
+    private:
+        friend class PendingTriggers;
+
+        static void OnTrigger(ButtonComboModule_ControllerTypes triggeredBy, ButtonComboModule_ComboHandle handle, void *context);
+
+        ButtonComboModule_ComboHandle mHandle;
+        FrameExecutor *mExecutor;
+        ButtonComboModule_CallbackOptions mPrevCallbackOptions = {};
+        TriggerResult mResult                                  = {BUTTON_COMBO_MODULE_ERROR_SUCCESS, BUTTON_COMBO_MODULE_CONTROLLER_NONE};
+        bool mFired                                            = false;
+        // Intrusive list of pending awaiters, guarded by PendingTriggers.
+        TriggerAwaiter *mPrevPending = nullptr;
+        TriggerAwaiter *mNextPending = nullptr;
+    };
+
+    /**
+     * @class DetectAwaiter
+     * @brief Awaiter returned by @ref DetectButtonComboAsync.
+     */
+    class DetectAwaiter : ExecutorNode {
+    public:
+        DetectAwaiter(const ButtonComboModule_DetectButtonComboOptions &options, FrameExecutor &executor) noexcept;
+
+        DetectAwaiter(const DetectAwaiter &)            = delete;
+        DetectAwaiter &operator=(const DetectAwaiter &) = delete;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+        DetectResult await_resume() noexcept { return mResult; }
+
+    private:
+        static void OnDetected(ButtonComboModule_Error error, ButtonComboModule_Buttons buttons, void *context);
+
+        ButtonComboModule_DetectButtonComboOptions mOptions;
+        FrameExecutor *mExecutor;
+        DetectResult mResult = {BUTTON_COMBO_MODULE_ERROR_SUCCESS, static_cast<ButtonComboModule_Buttons>(0)};
+    };
+
+    /**
+     * @brief Detects a combo without blocking. Use with `co_await`.
+     *
+     * The awaiting coroutine is resumed by `executor` once a combo (or the abort combo) has been detected.
+     * Wrapper for @ref ButtonComboModule_DetectButtonCombo_Async.
+     * @sa ButtonComboModule_DetectButtonCombo_Async
+     */
+    [[nodiscard]] DetectAwaiter DetectButtonComboAsync(const ButtonComboModule_DetectButtonComboOptions &options,
+                                                       FrameExecutor &executor = FrameExecutor::Main());
+} // namespace ButtonComboModule
+
+#endif
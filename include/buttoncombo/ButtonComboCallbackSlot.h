@@ -0,0 +1,61 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+namespace ButtonComboModule {
+
+    class ButtonCombo;
+
+    /**
+     * @class CallbackSlot
+     * @brief RAII wrapper for a @ref ButtonComboModule_CallbackSlot. Hands the current callback back to the module when
+     * destroyed.
+     *
+     * Has to outlive the combo, e.g. by declaring it before the ButtonCombo: a trigger that has been dispatched while the
+     * callback was being handed back may still enter the slot, see @ref ButtonComboModule_UninstallCallbackSlot.
+     * Not movable, the module keeps a pointer to it.
+     * @sa ButtonComboModule_InstallCallbackSlot
+     */
+    class CallbackSlot {
+    public:
+        explicit CallbackSlot(const ButtonCombo &combo);
+        ~CallbackSlot();
+
+        CallbackSlot(const CallbackSlot &)            = delete;
+        CallbackSlot &operator=(const CallbackSlot &) = delete;
+
+        /**
+         * @brief Returns the result of installing the slot. The slot is inactive if this is not SUCCESS.
+         */
+        [[nodiscard]] ButtonComboModule_Error GetError() const {
+            return mError;
+        }
+
+        /**
+         * @brief Publishes a new callback and context. Returns once no trigger is using the old pair anymore.
+         *
+         * Wrapper for @ref ButtonComboModule_SwapCallback. Returns BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT after
+         * @ref Uninstall.
+         * @sa ButtonComboModule_SwapCallback
+         */
+        ButtonComboModule_Error Swap(ButtonComboModule_ComboCallback callback,
+                                     void *context,
+                                     ButtonComboModule_CallbackOptions *outOldOptions = nullptr);
+
+        /**
+         * @brief Hands the current callback back to the module before the slot is destroyed. The slot still has to
+         * outlive the combo.
+         * @sa ButtonComboModule_UninstallCallbackSlot
+         */
+        ButtonComboModule_Error Uninstall();
+
+    private:
+        ButtonComboModule_CallbackSlot mSlot = {};
+        ButtonComboModule_Error mError       = BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR;
+        bool mInstalled                      = false;
+    };
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#ifdef __WIIU__
+#include <coreinit/event.h>
+#endif
+
+namespace ButtonComboModule {
+
+    class ButtonCombo;
+
+    /**
+     * @class CallbackExecutor
+     * @brief Interface for executors that run combo callbacks on a thread of their choice.
+     *
+     * C++ equivalent of @ref ButtonComboModule_Executor. Bind a combo to an executor with an @ref ExecutorBinding.
+     */
+    class CallbackExecutor {
+    public:
+        virtual ~CallbackExecutor() = default;
+
+        /**
+         * @brief Hands a trigger off to the executor.
+         *
+         * Called from the module's input thread, must not block or allocate.
+         *
+         * @return true if the trigger has been queued, false if it has been rejected.
+         */
+        virtual bool Post(const ButtonComboModule_TriggerRecord &record) noexcept = 0;
+
+        /**
+         * @brief Returns a C view of this executor that forwards to @ref Post.
+         */
+        [[nodiscard]] ButtonComboModule_Executor AsCExecutor() noexcept {
+            return {.post = PostThunk, .userData = this};
+        }
+
+    private:
+        static bool PostThunk(void *userData, const ButtonComboModule_TriggerRecord *record) {
+            return static_cast<CallbackExecutor *>(userData)->Post(*record);
+        }
+    };
+
+    /**
+     * @class CallbackQueue
+     * @brief Bounded, preallocated multi-producer multi-consumer queue of trigger records.
+     *
+     * Lock-free, neither pushing nor popping ever allocates. `Capacity` has to be a power of two.
+     */
+    template<uint32_t Capacity>
+    class CallbackQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity has to be a power of two");
+
+    public:
+        CallbackQueue() noexcept {
+            for (uint32_t i = 0; i < Capacity; i++) {
+                mSlots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        CallbackQueue(const CallbackQueue &)            = delete;
+        CallbackQueue &operator=(const CallbackQueue &) = delete;
+
+        /**
+         * @brief Appends a record. Returns false if the queue is full.
+         */
+        bool Push(const ButtonComboModule_TriggerRecord &record) noexcept {
+            uint32_t pos = mTail.load(std::memory_order_relaxed);
+            while (true) {
+                Slot &slot         = mSlots[pos & (Capacity - 1)];
+                const uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+                const int32_t diff = static_cast<int32_t>(seq - pos);
+                if (diff == 0) {
+                    if (mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        slot.record = record;
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = mTail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes the oldest record. Returns false if the queue is empty.
+         */
+        bool Pop(ButtonComboModule_TriggerRecord &outRecord) noexcept {
+            uint32_t pos = mHead.load(std::memory_order_relaxed);
+            while (true) {
+                Slot &slot         = mSlots[pos & (Capacity - 1)];
+                const uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+                const int32_t diff = static_cast<int32_t>(seq - (pos + 1));
+                if (diff == 0) {
+                    if (mHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        outRecord = slot.record;
+                        slot.sequence.store(pos + Capacity, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = mHead.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        struct Slot {
+            std::atomic<uint32_t> sequence;
+            ButtonComboModule_TriggerRecord record;
+        };
+
+        Slot mSlots[Capacity];
+        alignas(64) std::atomic<uint32_t> mTail = 0;
+        alignas(64) std::atomic<uint32_t> mHead = 0;
+    };
+
+    /**
+     * @class QueueExecutor
+     * @brief Executor that queues triggers until @ref Drain is called, e.g. once per frame or from an app-owned worker.
+     */
+    template<uint32_t Capacity = 64>
+    class QueueExecutor : public CallbackExecutor {
+    public:
+        bool Post(const ButtonComboModule_TriggerRecord &record) noexcept override {
+            return mQueue.Push(record);
+        }
+
+        /**
+         * @brief Runs the callbacks of all queued triggers on the calling thread.
+         *
+         * @return Number of executed callbacks.
+         */
+        uint32_t Drain() noexcept {
+            uint32_t executed = 0;
+            ButtonComboModule_TriggerRecord record;
+            while (mQueue.Pop(record)) {
+                if (record.callbackOptions.callback != nullptr) {
+                    record.callbackOptions.callback(record.triggeredBy, record.handle, record.callbackOptions.context);
+                }
+                executed++;
+            }
+            return executed;
+        }
+
+    private:
+        CallbackQueue<Capacity> mQueue;
+    };
+
+    /**
+     * @class ThreadExecutor
+     * @brief Executor that runs callbacks on its own worker thread.
+     *
+     * Based on `std::thread`, so it works on the console as well as on the host. On the console the worker can be
+     * pinned to a single core and sleeps on an `OSEvent`, on the host it waits on an atomic counter.
+     */
+    class ThreadExecutor : public CallbackExecutor {
+    public:
+        static constexpr int32_t ANY_CORE = -1;
+
+        /**
+         * @brief Starts the worker thread.
+         * @param core The core (0-2) the worker thread should run on. Ignored on the host.
+         */
+        explicit ThreadExecutor(int32_t core = ANY_CORE);
+
+        /**
+         * @brief Runs the callbacks of all triggers that have already been posted and joins the worker thread.
+         */
+        ~ThreadExecutor() override;
+
+        ThreadExecutor(const ThreadExecutor &)            = delete;
+        ThreadExecutor &operator=(const ThreadExecutor &) = delete;
+
+        bool Post(const ButtonComboModule_TriggerRecord &record) noexcept override;
+
+    private:
+        void Run(int32_t core);
+
+        void Wake() noexcept;
+
+        QueueExecutor<64> mQueue;
+#ifdef __WIIU__
+        OSEvent mPostedEvent;
+#else
+        std::atomic<uint32_t> mPosted = 0;
+#endif
+        std::atomic<bool> mStop = false;
+        std::thread mThread;
+    };
+
+    /**
+     * @class ExecutorBinding
+     * @brief RAII binding of a combo to an executor. Restores the original callback when destroyed.
+     *
+     * Has to outlive the combo, e.g. by declaring it before the ButtonCombo: a trigger that has been dispatched while
+     * the original callback was being restored may still use the binding, see @ref ButtonComboModule_UnbindExecutor.
+     * The executor has to outlive the binding. Not movable, the module keeps a pointer to it.
+     * @sa ButtonComboModule_BindExecutor
+     */
+    class ExecutorBinding {
+    public:
+        ExecutorBinding(const ButtonCombo &combo, CallbackExecutor &executor);
+        ~ExecutorBinding();
+
+        ExecutorBinding(const ExecutorBinding &)            = delete;
+        ExecutorBinding &operator=(const ExecutorBinding &) = delete;
+
+        /**
+         * @brief Returns the result of binding the combo. The binding is inactive if this is not SUCCESS.
+         */
+        [[nodiscard]] ButtonComboModule_Error GetError() const {
+            return mError;
+        }
+
+        /**
+         * @brief Returns the number of triggers the executor has rejected.
+         */
+        [[nodiscard]] uint32_t GetDroppedCount() const {
+            return __atomic_load_n(&mBinding.droppedCount, __ATOMIC_RELAXED);
+        }
+
+        /**
+         * @brief Restores the original callback before the binding is destroyed. The binding still has to outlive the
+         * combo.
+         * @sa ButtonComboModule_UnbindExecutor
+         */
+        ButtonComboModule_Error Unbind();
+
+    private:
+        ButtonComboModule_ExecutorBinding mBinding = {};
+        ButtonComboModule_Error mError             = BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR;
+        bool mBound                                = false;
+    };
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+#include "expected.h"
+#include <optional>
+
+#if !defined(BUTTONCOMBO_NO_EXCEPTIONS) && !defined(__cpp_exceptions)
+#define BUTTONCOMBO_NO_EXCEPTIONS
+#endif
+
+namespace ButtonComboModule {
+
+    class ButtonCombo;
+
+    /**
+     * @class ButtonComboGroup
+     * @brief RAII Wrapper for a ButtonComboModule combo group.
+     *
+     * Enables or disables all assigned combos with a single call. The group is destroyed via
+     * @ref ButtonComboModule_DestroyComboGroup when this object is destroyed, the combos stay registered and are enabled.
+     * @sa ButtonComboModule_CreateComboGroup
+     */
+    class ButtonComboGroup {
+    public:
+        /**
+         * @brief Creates an empty, enabled group.
+         */
+        static std::optional<ButtonComboGroup> Create(ButtonComboModule_Error &outError) noexcept;
+
+        /**
+         * @brief Creates an empty, enabled group (Non-throwing).
+         */
+        static expected<ButtonComboGroup, ButtonComboModule_Error> TryCreate() noexcept;
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
+        /**
+         * @brief Creates an empty, enabled group (Throwing).
+         */
+        static ButtonComboGroup Create();
+#endif
+
+        /**
+         * @brief Destructor. Calls @ref ButtonComboModule_DestroyComboGroup.
+         */
+        ~ButtonComboGroup();
+
+        // Movable, not copyable
+        ButtonComboGroup(const ButtonComboGroup &) = delete;
+        ButtonComboGroup(ButtonComboGroup &&src) noexcept;
+        ButtonComboGroup &operator=(const ButtonComboGroup &) = delete;
+        ButtonComboGroup &operator                            =(ButtonComboGroup &&src) noexcept;
+
+        /**
+         * @brief Returns the underlying C handle.
+         */
+        [[nodiscard]] ButtonComboModule_ComboGroupHandle getHandle() const {
+            return mHandle;
+        }
+
+        /**
+         * @brief Assigns a combo to this group.
+         * @sa ButtonComboModule_AddToComboGroup
+         */
+        ButtonComboModule_Error Add(const ButtonCombo &combo) const;
+
+        /**
+         * @brief Removes a combo from this group.
+         * @sa ButtonComboModule_RemoveFromComboGroup
+         */
+        ButtonComboModule_Error Remove(const ButtonCombo &combo) const;
+
+        /**
+         * @brief Enables or disables all combos of this group.
+         * @sa ButtonComboModule_SetComboGroupEnabled
+         */
+        ButtonComboModule_Error SetEnabled(bool enabled) const;
+
+    private:
+        void ReleaseGroupHandle();
+        explicit ButtonComboGroup(ButtonComboModule_ComboGroupHandle handle);
+        ButtonComboModule_ComboGroupHandle mHandle = ButtonComboModule_ComboGroupHandle(nullptr);
+    };
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+#include <span>
+
+namespace ButtonComboModule {
+
+    /**
+     * @class InputInjection
+     * @brief Scripted input for automated tests and macros. Ignores the real input of the masked controllers while
+     * the object is alive.
+     *
+     * The mask applies to the whole module. The controllers are added to the mask that is set when the object is
+     * created, and that mask is restored on destruction. Nested instances have to be destroyed in reverse order.
+     * @sa ButtonComboModule_InjectInput
+     * @sa ButtonComboModule_SetRealInputMask
+     */
+    class InputInjection {
+    public:
+        explicit InputInjection(ButtonComboModule_ControllerTypes maskedControllers = BUTTON_COMBO_MODULE_CONTROLLER_ALL);
+
+        /**
+         * @brief Restores the mask that was set before this object has been created.
+         */
+        ~InputInjection();
+
+        InputInjection(const InputInjection &)            = delete;
+        InputInjection &operator=(const InputInjection &) = delete;
+
+        /**
+         * @brief Returns the result of masking the real input. Injecting still works if this is not SUCCESS.
+         */
+        [[nodiscard]] ButtonComboModule_Error GetError() const {
+            return mError;
+        }
+
+        /**
+         * @brief Injects the held buttons of a single controller.
+         */
+        ButtonComboModule_Error Inject(ButtonComboModule_ControllerTypes controller,
+                                       ButtonComboModule_Buttons buttons,
+                                       OSTime sampleTime) const;
+
+        /**
+         * @brief Injects several samples, they are evaluated in order.
+         */
+        ButtonComboModule_Error Inject(std::span<const ButtonComboModule_InputSample> samples) const;
+
+    private:
+        ButtonComboModule_ControllerTypes mMaskedControllers;
+        ButtonComboModule_ControllerTypes mPreviousMask = BUTTON_COMBO_MODULE_CONTROLLER_NONE;
+        ButtonComboModule_Error mError                  = BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    };
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+/**
+ * @file ButtonComboLiterals.h
+ * @brief constexpr conversion between button masks and human-readable strings like "ZL+ZR+MINUS".
+ *
+ * Button names are the ButtonComboModule_Buttons enumerators without the `BCMPAD_BUTTON_` prefix, matched
+ * case-insensitively. The D-pad buttons are also accepted with a `DPAD_` prefix (e.g. "DPAD_DOWN").
+ */
+namespace ButtonComboModule {
+
+    namespace detail {
+        struct ButtonName {
+            std::string_view name;
+            ButtonComboModule_Buttons button;
+        };
+
+        // The first entry of each button is used for formatting.
+        inline constexpr ButtonName BUTTON_NAMES[] = {
+                {"A", BCMPAD_BUTTON_A},
+                {"B", BCMPAD_BUTTON_B},
+                {"X", BCMPAD_BUTTON_X},
+                {"Y", BCMPAD_BUTTON_Y},
+                {"LEFT", BCMPAD_BUTTON_LEFT},
+                {"RIGHT", BCMPAD_BUTTON_RIGHT},
+                {"UP", BCMPAD_BUTTON_UP},
+                {"DOWN", BCMPAD_BUTTON_DOWN},
+                {"ZL", BCMPAD_BUTTON_ZL},
+                {"ZR", BCMPAD_BUTTON_ZR},
+                {"L", BCMPAD_BUTTON_L},
+                {"R", BCMPAD_BUTTON_R},
+                {"PLUS", BCMPAD_BUTTON_PLUS},
+                {"MINUS", BCMPAD_BUTTON_MINUS},
+                {"STICK_R", BCMPAD_BUTTON_STICK_R},
+                {"STICK_L", BCMPAD_BUTTON_STICK_L},
+                {"TV", BCMPAD_BUTTON_TV},
+                {"1", BCMPAD_BUTTON_1},
+                {"2", BCMPAD_BUTTON_2},
+                {"C", BCMPAD_BUTTON_C},
+                {"Z", BCMPAD_BUTTON_Z},
+                {"STICK_L_LEFT", BCMPAD_BUTTON_STICK_L_LEFT},
+                {"STICK_L_RIGHT", BCMPAD_BUTTON_STICK_L_RIGHT},
+                {"STICK_L_UP", BCMPAD_BUTTON_STICK_L_UP},
+                {"STICK_L_DOWN", BCMPAD_BUTTON_STICK_L_DOWN},
+                {"STICK_R_LEFT", BCMPAD_BUTTON_STICK_R_LEFT},
+                {"STICK_R_RIGHT", BCMPAD_BUTTON_STICK_R_RIGHT},
+                {"STICK_R_UP", BCMPAD_BUTTON_STICK_R_UP},
+                {"STICK_R_DOWN", BCMPAD_BUTTON_STICK_R_DOWN},
+                {"DPAD_LEFT", BCMPAD_BUTTON_LEFT},
+                {"DPAD_RIGHT", BCMPAD_BUTTON_RIGHT},
+                {"DPAD_UP", BCMPAD_BUTTON_UP},
+                {"DPAD_DOWN", BCMPAD_BUTTON_DOWN},
+        };
+
+        constexpr char ToUpper(const char c) {
+            return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+        }
+
+        constexpr bool IsSpace(const char c) {
+            return c == ' ' || c == '\t';
+        }
+
+        constexpr std::string_view Trim(std::string_view str) {
+            while (!str.empty() && IsSpace(str.front())) {
+                str.remove_prefix(1);
+            }
+            while (!str.empty() && IsSpace(str.back())) {
+                str.remove_suffix(1);
+            }
+            return str;
+        }
+
+        constexpr bool EqualsIgnoreCase(const std::string_view a, const std::string_view b) {
+            if (a.size() != b.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < a.size(); i++) {
+                if (ToUpper(a[i]) != b[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Not constexpr on purpose, calling it from a consteval function is a compile error.
+        inline void UnknownButtonName() {}
+    } // namespace detail
+
+    /**
+     * @brief Parses a single button name, e.g. "ZL".
+     *
+     * @return The button, or 0 if the name is unknown.
+     */
+    constexpr ButtonComboModule_Buttons ParseButton(const std::string_view name) noexcept {
+        const auto trimmed = detail::Trim(name);
+        for (const auto &entry : detail::BUTTON_NAMES) {
+            if (detail::EqualsIgnoreCase(trimmed, entry.name)) {
+                return entry.button;
+            }
+        }
+        return static_cast<ButtonComboModule_Buttons>(0);
+    }
+
+    /**
+     * @brief Parses a combo like "ZL+ZR+MINUS" into a button mask. Never allocates.
+     *
+     * Whitespace around the names is ignored.
+     *
+     * @param text       The combo to parse.
+     * @param outButtons Set to the parsed mask. Only valid if true is returned.
+     * @return false if the text is empty or contains an unknown or empty name.
+     */
+    constexpr bool ParseButtons(std::string_view text, ButtonComboModule_Buttons &outButtons) noexcept {
+        uint32_t buttons = 0;
+        while (true) {
+            const size_t separator = text.find('+');
+            const auto button      = ParseButton(text.substr(0, separator));
+            if (button == 0) {
+                return false;
+            }
+            buttons |= button;
+            if (separator == std::string_view::npos) {
+                break;
+            }
+            text.remove_prefix(separator + 1);
+        }
+        outButtons = static_cast<ButtonComboModule_Buttons>(buttons);
+        return true;
+    }
+
+    /**
+     * @brief Writes a button mask as human-readable text like "ZL+ZR+MINUS" into a caller-provided buffer.
+     *
+     * Never allocates. Bits without a name are written as hex value.
+     *
+     * @param buttons   The mask to format.
+     * @param outBuffer Storage for the NUL-terminated text. The text is truncated if the buffer is too small.
+     * @return The length of the full text, excluding the NUL terminator.
+     */
+    constexpr uint32_t FormatButtons(const ButtonComboModule_Buttons buttons, const std::span<char> outBuffer) noexcept {
+        uint32_t length = 0;
+        auto append     = [&](const std::string_view str) {
+            for (const char c : str) {
+                if (length + 1 < outBuffer.size()) {
+                    outBuffer[length] = c;
+                }
+                length++;
+            }
+        };
+
+        uint32_t remaining = buttons;
+        for (const auto &entry : detail::BUTTON_NAMES) {
+            if ((remaining & entry.button) != 0) {
+                if (remaining != static_cast<uint32_t>(buttons)) {
+                    append("+");
+                }
+                append(entry.name);
+                remaining &= ~static_cast<uint32_t>(entry.button);
+            }
+        }
+        if (remaining != 0) {
+            if (remaining != static_cast<uint32_t>(buttons)) {
+                append("+");
+            }
+            char hex[10] = {'0', 'x'};
+            for (uint32_t i = 0; i < 8; i++) {
+                hex[2 + i] = "0123456789ABCDEF"[(remaining >> (28 - i * 4)) & 0xF];
+            }
+            append({hex, sizeof(hex)});
+        }
+        if (!outBuffer.empty()) {
+            outBuffer[length < outBuffer.size() ? length : outBuffer.size() - 1] = '\0';
+        }
+        return length;
+    }
+
+    namespace Literals {
+        /**
+         * @brief Turns a combo string into a button mask at compile time, e.g. `"ZL+ZR+MINUS"_combo`.
+         *
+         * Unknown button names are a compile error.
+         */
+        consteval ButtonComboModule_Buttons operator""_combo(const char *str, const size_t len) {
+            ButtonComboModule_Buttons buttons = {};
+            if (!ParseButtons({str, len}, buttons)) {
+                detail::UnknownButtonName();
+            }
+            return buttons;
+        }
+    } // namespace Literals
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string_view>
+
+namespace ButtonComboModule {
+
+    /**
+     * @class ComboSnapshotView
+     * @brief Non-owning view over a combo snapshot filled by @ref ButtonComboModule_GetComboSnapshot.
+     *
+     * Validates the header once, iterating never copies or allocates. A buffer with an unknown version, unaligned
+     * entries or inconsistent sizes results in an empty view. The buffer has to outlive the view.
+     *
+     * @code
+     * for (const auto &entry : ComboSnapshotView(buffer)) {
+     *     OSReport("%.*s (%.*s)\n", (int) entry.label.size(), entry.label.data(), (int) entry.owner.size(), entry.owner.data());
+     * }
+     * @endcode
+     */
+    class ComboSnapshotView {
+    public:
+        struct Entry {
+            const ButtonComboModule_SnapshotEntry *info = nullptr;
+            std::string_view label;
+            std::string_view owner;
+
+            const ButtonComboModule_SnapshotEntry *operator->() const {
+                return info;
+            }
+        };
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Entry;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const Entry *;
+            using reference         = const Entry &;
+
+            Iterator() = default;
+
+            reference operator*() const {
+                return mEntry;
+            }
+
+            pointer operator->() const {
+                return &mEntry;
+            }
+
+            Iterator &operator++() {
+                mIndex++;
+                Load();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator &other) const {
+                return mIndex == other.mIndex;
+            }
+
+        private:
+            friend class ComboSnapshotView;
+
+            Iterator(const ComboSnapshotView *view, const uint32_t index) : mView(view), mIndex(index) {
+                Load();
+            }
+
+            void Load() {
+                if (mView != nullptr && mIndex < mView->size()) {
+                    mEntry = (*mView)[mIndex];
+                }
+            }
+
+            const ComboSnapshotView *mView = nullptr;
+            uint32_t mIndex                = 0;
+            Entry mEntry                   = {};
+        };
+
+        ComboSnapshotView() = default;
+
+        ComboSnapshotView(const void *buffer, const uint32_t bufferSize) noexcept {
+            if (buffer == nullptr || bufferSize < sizeof(ButtonComboModule_SnapshotHeader)) {
+                return;
+            }
+            const auto *header = static_cast<const ButtonComboModule_SnapshotHeader *>(buffer);
+            if (header->version != BUTTON_COMBO_MODULE_SNAPSHOT_VERSION ||
+                header->headerSize < sizeof(ButtonComboModule_SnapshotHeader) ||
+                header->entrySize < sizeof(ButtonComboModule_SnapshotEntry) ||
+                (header->headerSize & 3) != 0 ||
+                (header->entrySize & 3) != 0 ||
+                header->headerSize > bufferSize ||
+                header->entryCount > (bufferSize - header->headerSize) / header->entrySize ||
+                header->stringPoolOffset > bufferSize ||
+                header->stringPoolSize > bufferSize - header->stringPoolOffset) {
+                return;
+            }
+            mData   = static_cast<const uint8_t *>(buffer);
+            mHeader = header;
+        }
+
+        explicit ComboSnapshotView(const std::span<const uint32_t> buffer) noexcept
+            : ComboSnapshotView(buffer.data(), static_cast<uint32_t>(buffer.size_bytes())) {}
+
+        /**
+         * @brief Returns false if the buffer doesn't contain a valid snapshot.
+         */
+        [[nodiscard]] bool IsValid() const {
+            return mHeader != nullptr;
+        }
+
+        [[nodiscard]] uint32_t size() const {
+            return mHeader != nullptr ? mHeader->entryCount : 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size() == 0;
+        }
+
+        [[nodiscard]] Entry operator[](const uint32_t index) const {
+            const auto *info = reinterpret_cast<const ButtonComboModule_SnapshotEntry *>(mData + mHeader->headerSize + index * mHeader->entrySize);
+            return {.info = info, .label = GetString(info->labelOffset), .owner = GetString(info->ownerOffset)};
+        }
+
+        [[nodiscard]] Iterator begin() const {
+            return {this, 0};
+        }
+
+        [[nodiscard]] Iterator end() const {
+            return {this, size()};
+        }
+
+    private:
+        [[nodiscard]] std::string_view GetString(const uint32_t offset) const {
+            if (offset >= mHeader->stringPoolSize) {
+                return {};
+            }
+            const auto *str     = reinterpret_cast<const char *>(mData + mHeader->stringPoolOffset + offset);
+            const size_t maxLen = mHeader->stringPoolSize - offset;
+            size_t len          = 0;
+            while (len < maxLen && str[len] != '\0') {
+                len++;
+            }
+            return {str, len};
+        }
+
+        const uint8_t *mData                            = nullptr;
+        const ButtonComboModule_SnapshotHeader *mHeader = nullptr;
+    };
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "ButtonCombo.h"
+#include "defines.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief A single entry of a @ref ComboTable. Use @ref PressDownEntry or @ref HoldEntry to create it.
+     */
+    struct ComboEntry {
+        const char *label;
+        ButtonComboModule_ComboType type;
+        ButtonComboModule_ControllerTypes controllerMask;
+        ButtonComboModule_Buttons combo;
+        uint32_t holdDurationInMs;
+        ButtonComboModule_ComboCallback callback;
+        void *context;
+    };
+
+    constexpr ComboEntry PressDownEntry(const char *label,
+                                        const ButtonComboModule_ControllerTypes controllerMask,
+                                        const ButtonComboModule_Buttons combo,
+                                        const ButtonComboModule_ComboCallback callback,
+                                        void *context       = nullptr,
+                                        const bool observer = false) {
+        return {.label            = label,
+                .type             = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN,
+                .controllerMask   = controllerMask,
+                .combo            = combo,
+                .holdDurationInMs = 0,
+                .callback         = callback,
+                .context          = context};
+    }
+
+    constexpr ComboEntry HoldEntry(const char *label,
+                                   const ButtonComboModule_ControllerTypes controllerMask,
+                                   const ButtonComboModule_Buttons combo,
+                                   const uint32_t holdDurationInMs,
+                                   const ButtonComboModule_ComboCallback callback,
+                                   void *context       = nullptr,
+                                   const bool observer = false) {
+        return {.label            = label,
+                .type             = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD,
+                .controllerMask   = controllerMask,
+                .combo            = combo,
+                .holdDurationInMs = holdDurationInMs,
+                .callback         = callback,
+                .context          = context};
+    }
+
+    namespace detail {
+        inline constexpr uint32_t WIIMOTE_ONLY_BUTTONS = BCMPAD_BUTTON_1 | BCMPAD_BUTTON_2 | BCMPAD_BUTTON_C | BCMPAD_BUTTON_Z;
+
+        // Not constexpr on purpose. Calling one of them from a consteval function is a compile error that names the problem.
+        inline void ComboTableError_EmptyControllerMask() {}
+        inline void ComboTableError_EmptyCombo() {}
+        inline void ComboTableError_ReservedButton() {}
+        inline void ComboTableError_WiimoteOnlyButtonWithoutWPAD() {}
+        inline void ComboTableError_HoldDurationMissing() {}
+        inline void ComboTableError_CallbackMissing() {}
+        inline void ComboTableError_ConflictingEntries() {}
+
+        constexpr bool IsObserver(const ButtonComboModule_ComboType type) {
+            return type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER || type == BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER;
+        }
+
+        constexpr bool IsHold(const ButtonComboModule_ComboType type) {
+            return type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD || type == BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER;
+        }
+
+        // Same rule as the module: two combos on a shared controller conflict if one contains the other.
+        constexpr bool IsConflict(const ComboEntry &a, const ComboEntry &b) {
+            if (IsObserver(a.type) || IsObserver(b.type) || (a.controllerMask & b.controllerMask) == 0) {
+                return false;
+            }
+            return (a.combo & b.combo) == a.combo || (a.combo & b.combo) == b.combo;
+        }
+    } // namespace detail
+
+    /**
+     * @class ComboTable
+     * @brief A fixed table of combos that is validated at compile time.
+     *
+     * Invalid entries (e.g. Wiimote-only buttons on a VPAD-only mask, missing hold durations) and conflicts between
+     * non-observer entries of the table are compile errors. The @ref ButtonComboModule_ComboOptions are built at
+     * compile time as well, register them with @ref RegisterComboTable.
+     *
+     * Conflicts with combos of other clients can only be detected at runtime.
+     *
+     * @code
+     * constexpr ButtonComboModule::ComboTable COMBOS({
+     *         ButtonComboModule::PressDownEntry("Screenshot", BUTTON_COMBO_MODULE_CONTROLLER_ALL, BCMPAD_BUTTON_ZL | BCMPAD_BUTTON_ZR, OnScreenshot),
+     *         ButtonComboModule::HoldEntry("Menu", BUTTON_COMBO_MODULE_CONTROLLER_WPAD, BCMPAD_BUTTON_1 | BCMPAD_BUTTON_2, 500, OnMenu),
+     * });
+     * @endcode
+     */
+    template<size_t N>
+    class ComboTable {
+    public:
+        consteval explicit ComboTable(const ComboEntry (&entries)[N]) : mOptions() {
+            for (size_t i = 0; i < N; i++) {
+                const auto &entry = entries[i];
+                if (entry.controllerMask == 0) {
+                    detail::ComboTableError_EmptyControllerMask();
+                }
+                if (entry.combo == 0) {
+                    detail::ComboTableError_EmptyCombo();
+                }
+                if ((entry.combo & BCMPAD_BUTTON_RESERVED_BIT) != 0) {
+                    detail::ComboTableError_ReservedButton();
+                }
+                if ((entry.combo & detail::WIIMOTE_ONLY_BUTTONS) != 0 && (entry.controllerMask & BUTTON_COMBO_MODULE_CONTROLLER_WPAD) == 0) {
+                    detail::ComboTableError_WiimoteOnlyButtonWithoutWPAD();
+                }
+                if (detail::IsHold(entry.type) && entry.holdDurationInMs == 0) {
+                    detail::ComboTableError_HoldDurationMissing();
+                }
+                if (entry.callback == nullptr) {
+                    detail::ComboTableError_CallbackMissing();
+                }
+                for (size_t j = 0; j < i; j++) {
+                    if (detail::IsConflict(entries[j], entry)) {
+                        detail::ComboTableError_ConflictingEntries();
+                    }
+                }
+
+                auto &options                                        = mOptions[i];
+                options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
+                options.metaOptions.label                            = entry.label;
+                options.callbackOptions                              = {.callback = entry.callback, .context = entry.context};
+                options.buttonComboOptions.type                      = entry.type;
+                options.buttonComboOptions.basicCombo.controllerMask = entry.controllerMask;
+                options.buttonComboOptions.basicCombo.combo          = entry.combo;
+                options.buttonComboOptions.optionalHoldForXMs        = entry.holdDurationInMs;
+            }
+        }
+
+        [[nodiscard]] static constexpr size_t size() {
+            return N;
+        }
+
+        [[nodiscard]] constexpr const std::array<ButtonComboModule_ComboOptions, N> &GetOptions() const {
+            return mOptions;
+        }
+
+    private:
+        std::array<ButtonComboModule_ComboOptions, N> mOptions;
+    };
+
+    /**
+     * @brief Registers all combos of a table.
+     *
+     * All or nothing: if one combo can't be added, the already added combos of the table are removed again.
+     * Entries may still end up in the CONFLICT state because of combos of other clients, check the status via
+     * @ref ButtonCombo::GetButtonComboStatus.
+     *
+     * @param table     The table to register.
+     * @param outCombos Set to the combos, in the order of the table. Reset if an error is returned.
+     * @return BUTTON_COMBO_MODULE_ERROR_SUCCESS or the error of the first combo that couldn't be added.
+     */
+    template<size_t N>
+    ButtonComboModule_Error RegisterComboTable(const ComboTable<N> &table, std::array<std::optional<ButtonCombo>, N> &outCombos) noexcept {
+        ButtonComboModule_ComboStatus status;
+        for (size_t i = 0; i < N; i++) {
+            auto res = ButtonCombo::TryCreate(table.GetOptions()[i], status);
+            if (!res) {
+                for (auto &combo : outCombos) {
+                    combo.reset();
+                }
+                return res.error();
+            }
+            outCombos[i] = std::move(*res);
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
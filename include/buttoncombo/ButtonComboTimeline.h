@@ -0,0 +1,221 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include "defines.h"
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+/**
+ * @file ButtonComboTimeline.h
+ * @brief Reads timeline dumps written by @ref ButtonComboModule_WriteTimelineDump and converts them to the Chrome
+ * trace event format, e.g. to load them in Perfetto or chrome://tracing.
+ *
+ * Header-only and independent of the module, so it can be used on the console as well as in host tools. Dumps are
+ * read in either byte order.
+ */
+namespace ButtonComboModule {
+
+    namespace detail {
+        inline constexpr const char *TIMELINE_CONTROLLER_NAMES[BUTTON_COMBO_MODULE_CONTROLLER_COUNT] = {"VPAD_0", "VPAD_1", "WPAD_0", "WPAD_1", "WPAD_2", "WPAD_3", "WPAD_4", "WPAD_5", "WPAD_6"};
+
+        constexpr bool IsTimelineSlice(const uint32_t state) {
+            return state == BUTTON_COMBO_MODULE_TIMELINE_STATE_ARMING || state == BUTTON_COMBO_MODULE_TIMELINE_STATE_HELD;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Returns the name of a @ref ButtonComboModule_TimelineState, e.g. "ARMING".
+     */
+    constexpr const char *GetTimelineStateName(const uint32_t state) {
+        switch (state) {
+            case BUTTON_COMBO_MODULE_TIMELINE_STATE_IDLE:
+                return "IDLE";
+            case BUTTON_COMBO_MODULE_TIMELINE_STATE_ARMING:
+                return "ARMING";
+            case BUTTON_COMBO_MODULE_TIMELINE_STATE_FIRED:
+                return "FIRED";
+            case BUTTON_COMBO_MODULE_TIMELINE_STATE_SUPPRESSED:
+                return "SUPPRESSED";
+            case BUTTON_COMBO_MODULE_TIMELINE_STATE_HELD:
+                return "HELD";
+        }
+        return "UNKNOWN";
+    }
+
+    /**
+     * @class TimelineDumpView
+     * @brief Non-owning view over a timeline dump.
+     *
+     * Validates the header once. A dump with an unknown magic or version, or inconsistent sizes results in an empty
+     * view. The buffer has to outlive the view, it doesn't need to be aligned.
+     */
+    class TimelineDumpView {
+    public:
+        TimelineDumpView() = default;
+
+        TimelineDumpView(const void *buffer, const uint32_t bufferSize) noexcept {
+            if (buffer == nullptr || bufferSize < sizeof(ButtonComboModule_TimelineDumpHeader)) {
+                return;
+            }
+            mData = static_cast<const uint8_t *>(buffer);
+            memcpy(&mHeader, mData, sizeof(mHeader));
+            if (mHeader.magic != BUTTON_COMBO_MODULE_TIMELINE_DUMP_MAGIC) {
+                if (mHeader.magic != __builtin_bswap32(BUTTON_COMBO_MODULE_TIMELINE_DUMP_MAGIC)) {
+                    mData = nullptr;
+                    return;
+                }
+                mSwapped = true;
+                for (auto *field = reinterpret_cast<uint32_t *>(&mHeader); field < reinterpret_cast<uint32_t *>(&mHeader + 1); field++) {
+                    *field = __builtin_bswap32(*field);
+                }
+            }
+            if (mHeader.version != BUTTON_COMBO_MODULE_TIMELINE_DUMP_VERSION ||
+                mHeader.headerSize < sizeof(ButtonComboModule_TimelineDumpHeader) ||
+                mHeader.eventSize < sizeof(ButtonComboModule_TimelineDumpEvent) ||
+                mHeader.comboSize < sizeof(ButtonComboModule_TimelineDumpCombo) ||
+                mHeader.headerSize > bufferSize ||
+                mHeader.eventCount > (bufferSize - mHeader.headerSize) / mHeader.eventSize ||
+                mHeader.comboOffset > bufferSize ||
+                mHeader.comboCount > (bufferSize - mHeader.comboOffset) / mHeader.comboSize ||
+                mHeader.ticksPerSecond == 0) {
+                mData = nullptr;
+            }
+        }
+
+        /**
+         * @brief Returns false if the buffer doesn't contain a valid dump.
+         */
+        [[nodiscard]] bool IsValid() const {
+            return mData != nullptr;
+        }
+
+        [[nodiscard]] uint32_t GetEventCount() const {
+            return IsValid() ? mHeader.eventCount : 0;
+        }
+
+        [[nodiscard]] uint32_t GetDroppedCount() const {
+            return IsValid() ? mHeader.droppedCount : 0;
+        }
+
+        [[nodiscard]] uint32_t GetComboCount() const {
+            return IsValid() ? mHeader.comboCount : 0;
+        }
+
+        [[nodiscard]] uint32_t GetTicksPerSecond() const {
+            return mHeader.ticksPerSecond;
+        }
+
+        /**
+         * @brief Returns an event in host byte order. `index` must be smaller than @ref GetEventCount.
+         */
+        [[nodiscard]] ButtonComboModule_TimelineDumpEvent GetEvent(const uint32_t index) const {
+            ButtonComboModule_TimelineDumpEvent event;
+            memcpy(&event, mData + mHeader.headerSize + index * mHeader.eventSize, sizeof(event));
+            if (mSwapped) {
+                event.sampleTime    = static_cast<int64_t>(__builtin_bswap64(static_cast<uint64_t>(event.sampleTime)));
+                event.comboIndex    = __builtin_bswap32(event.comboIndex);
+                event.controller    = __builtin_bswap32(event.controller);
+                event.previousState = __builtin_bswap32(event.previousState);
+                event.state         = __builtin_bswap32(event.state);
+                event.heldForInMs   = __builtin_bswap32(event.heldForInMs);
+            }
+            return event;
+        }
+
+        /**
+         * @brief Returns the label of a combo, or an empty string if the index is out of range.
+         */
+        [[nodiscard]] std::string_view GetComboLabel(const uint32_t index) const {
+            if (index >= GetComboCount()) {
+                return {};
+            }
+            const auto *label = reinterpret_cast<const char *>(mData + mHeader.comboOffset + index * mHeader.comboSize);
+            return {label, strnlen(label, BUTTON_COMBO_MODULE_TIMELINE_LABEL_LENGTH)};
+        }
+
+    private:
+        const uint8_t *mData                         = nullptr;
+        ButtonComboModule_TimelineDumpHeader mHeader = {};
+        bool mSwapped                                = false;
+    };
+
+    /**
+     * @brief Writes a timeline dump as Chrome trace event JSON.
+     *
+     * Every combo is shown as a process and every controller as a thread of it. ARMING and HELD are slices, FIRED and
+     * SUPPRESSED are instant events. Timestamps are relative to the oldest event. Never allocates.
+     *
+     * @param view  The dump to convert.
+     * @param write Called with consecutive chunks of the JSON text, e.g. `[&](std::string_view s) { fwrite(s.data(), 1, s.size(), file); }`.
+     * @return false if the view is invalid, nothing is written in that case.
+     */
+    template<typename Writer>
+    bool WriteChromeTrace(const TimelineDumpView &view, Writer &&write) {
+        if (!view.IsValid()) {
+            return false;
+        }
+
+        char line[512];
+        auto emit = [&](const int length) {
+            if (length > 0) {
+                write(std::string_view(line, static_cast<size_t>(length) < sizeof(line) ? static_cast<size_t>(length) : sizeof(line) - 1));
+            }
+        };
+
+        emit(snprintf(line, sizeof(line), "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":%" PRIu32 "},\"traceEvents\":[\n", view.GetDroppedCount()));
+
+        const char *separator = "";
+        for (uint32_t i = 0; i < view.GetComboCount(); i++) {
+            // Labels are at most 63 characters, escaped they still fit into `line`.
+            char label[BUTTON_COMBO_MODULE_TIMELINE_LABEL_LENGTH * 6];
+            size_t length = 0;
+            for (const char c : view.GetComboLabel(i)) {
+                if (c == '"' || c == '\\') {
+                    label[length++] = '\\';
+                    label[length++] = c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    length += snprintf(label + length, sizeof(label) - length, "\\u%04x", static_cast<unsigned>(c));
+                } else {
+                    label[length++] = c;
+                }
+            }
+            label[length] = '\0';
+            emit(snprintf(line, sizeof(line), "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%" PRIu32 ",\"args\":{\"name\":\"%s\"}}", separator, i + 1, label[0] != '\0' ? label : "<unknown>"));
+            separator = ",\n";
+            for (uint32_t controller = 0; controller < BUTTON_COMBO_MODULE_CONTROLLER_COUNT; controller++) {
+                emit(snprintf(line, sizeof(line), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32 ",\"args\":{\"name\":\"%s\"}}", i + 1, controller, detail::TIMELINE_CONTROLLER_NAMES[controller]));
+            }
+        }
+
+        const int64_t startTime = view.GetEventCount() > 0 ? view.GetEvent(0).sampleTime : 0;
+        for (uint32_t i = 0; i < view.GetEventCount(); i++) {
+            const auto event   = view.GetEvent(i);
+            const double ts    = static_cast<double>(event.sampleTime - startTime) * 1000000.0 / view.GetTicksPerSecond();
+            const uint32_t pid = event.comboIndex + 1;
+            const uint32_t tid = event.controller != 0 ? static_cast<uint32_t>(__builtin_ctz(event.controller)) : 0;
+            const bool slice   = detail::IsTimelineSlice(event.state);
+            if (detail::IsTimelineSlice(event.previousState)) {
+                emit(snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"E\",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32 ",\"ts\":%.3f}", separator, GetTimelineStateName(event.previousState), pid, tid, ts));
+                separator = ",\n";
+            }
+            if (event.state == BUTTON_COMBO_MODULE_TIMELINE_STATE_IDLE) {
+                continue;
+            }
+            // Instant events are scoped to the controller.
+            emit(snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"%s\"%s,\"pid\":%" PRIu32 ",\"tid\":%" PRIu32 ",\"ts\":%.3f,\"args\":{\"heldForInMs\":%" PRIu32 "}}",
+                          separator, GetTimelineStateName(event.state), slice ? "B" : "i", slice ? "" : ",\"s\":\"t\"", pid, tid, ts, event.heldForInMs));
+            separator = ",\n";
+        }
+
+        write(std::string_view("\n]}\n"));
+        return true;
+    }
+} // namespace ButtonComboModule
+
+#endif
\ No newline at end of file
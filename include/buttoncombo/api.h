@@ -8,6 +8,7 @@
 #pragma once
 
 #include "defines.h"
+#include "dispatch.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +38,14 @@ const char *ButtonComboModule_GetControllerTypeStr(ButtonComboModule_ControllerT
  */
 const char *ButtonComboModule_GetComboStatusStr(ButtonComboModule_ComboStatus status);
 
+/**
+ * @brief Returns a string representation of the provided ButtonComboModule_ConflictKind.
+ *
+ * @param kind The conflict kind to convert.
+ * @return A pointer to a string literal describing the provided conflict kind.
+ */
+const char *ButtonComboModule_GetConflictKindStr(ButtonComboModule_ConflictKind kind);
+
 
 /**
  * @brief Initializes the ButtonComboModule library.
@@ -44,6 +53,10 @@ const char *ButtonComboModule_GetComboStatusStr(ButtonComboModule_ComboStatus st
  * This function must be called before any other function in this library (except ButtonComboModule_GetVersion).
  * It locates the WUMS module and resolves the function pointers.
  *
+ * The library is reference counted: It's safe to call this function from multiple threads or components, each
+ * successful call must be balanced by a call to @ref ButtonComboModule_DeInitLibrary. Only the first call loads the
+ * module, subsequent calls just increase the reference count.
+ *
  * @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS                 The library was initialized successfully.
  * @retval BUTTON_COMBO_MODULE_ERROR_MODULE_NOT_FOUND        The ButtonComboModule.wms could not be found. Ensure it is running.
  * @retval BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT   The module is running but is missing expected exports.
@@ -54,6 +67,14 @@ ButtonComboModule_Error ButtonComboModule_InitLibrary();
 /**
  * @brief Deinitializes the ButtonComboModule library.
  *
+ * Drops one reference taken by @ref ButtonComboModule_InitLibrary. The module is released once the last reference is
+ * gone, no other thread may still be calling into the library at that point. Calling this function while the library
+ * is not initialized is a no-op.
+ *
+ * When the last reference is dropped, all combos that are still owned by `ButtonComboModule::ButtonCombo` objects are
+ * removed from the module and the objects are detached. Handles that were added via the C API must still be removed
+ * manually.
+ *
  * @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS       Deinitialization was successful.
  * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR Deinitialization failed.
  */
@@ -82,6 +103,23 @@ ButtonComboModule_Error ButtonComboModule_GetVersion(ButtonComboModule_APIVersio
  * This function registers a new combo based on the provided generic `ButtonComboModule_ComboOptions`.
  * Depending on the options, the combo can detect simple presses or hold durations on specific controllers.
  *
+ * @section Extended options
+ * If `options->version` is set to @ref BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX (**requires API version 2 or
+ * higher**), `options->callbackEx` is called instead of `options->callbackOptions.callback`. It receives a
+ * @ref ButtonComboModule_TriggerInfo with the input timestamp, the dispatch timestamp, the actual hold duration and
+ * all buttons held on the triggering controller.
+ *
+ * The extended options version also enables `options->triggerFilter`, see @ref ButtonComboModule_TriggerFilter.
+ * Triggers that are filtered out are suppressed before any callback is dispatched.
+ *
+ * @section Expression combos
+ * If `options->version` is set to @ref BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION (**requires API version 2
+ * or higher**), `options->expression` is used instead of `options->buttonComboOptions.basicCombo.combo`, see
+ * @ref ButtonComboModule_ComboExpression. All extended options are supported as well.
+ * For conflict checks, two combos only conflict if every button state that triggers one of them also triggers the
+ * other one. For plain combos this is the same as the rule below, but e.g. "L+R without ZR" doesn't conflict with
+ * "L+R+ZR".
+ *
  * @section Conflict Handling
  * The behavior regarding conflicts depends on the `type` set in the options:
  *
@@ -90,6 +128,7 @@ ButtonComboModule_Error ButtonComboModule_GetVersion(ButtonComboModule_APIVersio
  * - If a conflict is detected, the new combo is registered but `outStatus` is set to @ref BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT.
  * - In this state, the **callback will not trigger** even if the buttons are pressed.
  * - The existing combo that caused the conflict remains valid and unaffected.
+ * - Use @ref ButtonComboModule_GetButtonComboConflicts to find out which combos block it.
  *
  * - **Observer:**
  * The module does **not** check for conflicts. The callback will trigger regardless of other existing combos.
@@ -120,15 +159,16 @@ ButtonComboModule_Error ButtonComboModule_GetVersion(ButtonComboModule_APIVersio
  * @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS                       Combo successfully created. Check outStatus for validity.
  * @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT              options or outHandle is NULL, or the callback in options is NULL.
  * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED             The library is not initialized.
- * @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION  The options struct version is incorrect.
+ * @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION  The options or trigger filter struct version is incorrect or not supported by the loaded module.
+ * @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND           The combo contains stick directions, but the loaded module has API version 1.
  * @retval BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO                 The button combination or controller mask in options is empty/0.
  * @retval BUTTON_COMBO_MODULE_ERROR_DURATION_MISSING              The type is HOLD but holdDuration is 0.
  * @retval BUTTON_COMBO_MODULE_ERROR_INVALID_COMBO_TYPE            The combo type in options is unknown.
  * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR                 The module is in an invalid state.
  */
-ButtonComboModule_Error ButtonComboModule_AddButtonCombo(const ButtonComboModule_ComboOptions *options,
-                                                         ButtonComboModule_ComboHandle *outHandle,
-                                                         ButtonComboModule_ComboStatus *outStatus);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_AddButtonCombo(const ButtonComboModule_ComboOptions *options,
+                                                                         ButtonComboModule_ComboHandle *outHandle,
+                                                                         ButtonComboModule_ComboStatus *outStatus);
 
 /**
  * @brief Helper to create a "PressDown" combo with extended options.
@@ -198,6 +238,55 @@ ButtonComboModule_Error ButtonComboModule_AddButtonComboPressDownObserver(const
                                                                           ButtonComboModule_ComboHandle *outHandle,
                                                                           ButtonComboModule_ComboStatus *outStatus);
 
+/**
+ * @brief Helper to create a "PressDown" combo with a cooldown and/or debounce time.
+ *
+ * **Requires ButtonComboModule API version 2 or higher.**
+ *
+ * Same as @ref ButtonComboModule_AddButtonComboPressDownEx, but triggers within `cooldownInMs` of the previous
+ * trigger, or after the combo was released for less than `debounceInMs`, are suppressed by the module.
+ *
+ * @see ButtonComboModule_AddButtonComboPressDownEx
+ * @see ButtonComboModule_UpdateTriggerFilter
+ *
+ * @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION The loaded module does not support trigger filtering.
+ */
+ButtonComboModule_Error ButtonComboModule_AddButtonComboPressDownFiltered(const char *label,
+                                                                          ButtonComboModule_ControllerTypes controllerMask,
+                                                                          ButtonComboModule_Buttons combo,
+                                                                          uint32_t cooldownInMs,
+                                                                          uint32_t debounceInMs,
+                                                                          ButtonComboModule_ComboCallback callback,
+                                                                          void *context,
+                                                                          bool observer,
+                                                                          ButtonComboModule_ComboHandle *outHandle,
+                                                                          ButtonComboModule_ComboStatus *outStatus);
+
+/**
+ * @brief Helper to create an expression combo.
+ *
+ * **Requires ButtonComboModule API version 2 or higher.**
+ *
+ * A single expression combo can replace several plain combos and observers, e.g. "A or B while ZR is not held".
+ *
+ * @see ButtonComboModule_ComboExpression
+ * @see ButtonComboModule_AddButtonComboPressDownEx
+ *
+ * @param[in]  holdDurationInMs Duration in milliseconds the expression must be satisfied. 0 creates a "PressDown" combo.
+ * @param[in]  expression       The expression to detect. Must not be NULL. Copied by the module.
+ *
+ * @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION The loaded module does not support expression combos.
+ */
+ButtonComboModule_Error ButtonComboModule_AddButtonComboExpression(const char *label,
+                                                                   ButtonComboModule_ControllerTypes controllerMask,
+                                                                   const ButtonComboModule_ComboExpression *expression,
+                                                                   uint32_t holdDurationInMs,
+                                                                   ButtonComboModule_ComboCallback callback,
+                                                                   void *context,
+                                                                   bool observer,
+                                                                   ButtonComboModule_ComboHandle *outHandle,
+                                                                   ButtonComboModule_ComboStatus *outStatus);
+
 
 /**
   * @brief Helper to create a "Hold" combo with extended options.
@@ -288,7 +377,27 @@ ButtonComboModule_Error ButtonComboModule_AddButtonComboHoldObserver(const char
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_RemoveButtonCombo(ButtonComboModule_ComboHandle handle);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveButtonCombo(ButtonComboModule_ComboHandle handle);
+
+/**
+* @brief Removes multiple previously registered button combos at once.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Behaves like calling @ref ButtonComboModule_RemoveButtonCombo for each handle, but only has to synchronize with the
+* module once. Handles that are not found are ignored.
+*
+* @param[in] handles Array of handles to remove. Must not be NULL if count is not 0. Must not contain NULL handles.
+* @param[in] count   Number of handles in the array.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combos were removed or were not found.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handles is NULL or contains a NULL handle.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveButtonCombos(const ButtonComboModule_ComboHandle *handles,
+                                                                             uint32_t count);
 
 /**
  * @brief Retrieves the current status of a combo.
@@ -303,8 +412,8 @@ ButtonComboModule_Error ButtonComboModule_RemoveButtonCombo(ButtonComboModule_Co
  * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
  * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
  */
-ButtonComboModule_Error ButtonComboModule_GetButtonComboStatus(ButtonComboModule_ComboHandle handle,
-                                                               ButtonComboModule_ComboStatus *outStatus);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboStatus(ButtonComboModule_ComboHandle handle,
+                                                                               ButtonComboModule_ComboStatus *outStatus);
 
 /**
 * @brief Updates the metadata (label) for a specific combo.
@@ -319,8 +428,8 @@ ButtonComboModule_Error ButtonComboModule_GetButtonComboStatus(ButtonComboModule
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_UpdateButtonComboMeta(ButtonComboModule_ComboHandle handle,
-                                                                const ButtonComboModule_MetaOptions *metaOptions);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonComboMeta(ButtonComboModule_ComboHandle handle,
+                                                                                const ButtonComboModule_MetaOptions *metaOptions);
 
 /**
 * @brief Updates the callback function and context for a combo.
@@ -335,8 +444,8 @@ ButtonComboModule_Error ButtonComboModule_UpdateButtonComboMeta(ButtonComboModul
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_UpdateButtonComboCallback(ButtonComboModule_ComboHandle handle,
-                                                                    const ButtonComboModule_CallbackOptions *callbackOptions);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonComboCallback(ButtonComboModule_ComboHandle handle,
+                                                                                    const ButtonComboModule_CallbackOptions *callbackOptions);
 
 /**
 * @brief Updates the controller mask for a combo.
@@ -355,9 +464,9 @@ ButtonComboModule_Error ButtonComboModule_UpdateButtonComboCallback(ButtonComboM
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_UpdateControllerMask(ButtonComboModule_ComboHandle handle,
-                                                               ButtonComboModule_ControllerTypes controllerMask,
-                                                               ButtonComboModule_ComboStatus *outStatus);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateControllerMask(ButtonComboModule_ComboHandle handle,
+                                                                               ButtonComboModule_ControllerTypes controllerMask,
+                                                                               ButtonComboModule_ComboStatus *outStatus);
 
 /**
 * @brief Updates the button combination for a combo.
@@ -370,14 +479,15 @@ ButtonComboModule_Error ButtonComboModule_UpdateControllerMask(ButtonComboModule
 * @param[in]  combo     The new button bitmask. Must not be empty.
 * @param[out] outStatus (Optional) Storage for the new status.
 *
-* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS            Buttons updated (check outStatus for Validity).
-* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT   handle is NULL or **handle not found**.
-* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
-* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Buttons updated (check outStatus for Validity).
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND combo contains stick directions, but the loaded module has API version 1.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_UpdateButtonCombo(ButtonComboModule_ComboHandle handle,
-                                                            ButtonComboModule_Buttons combo,
-                                                            ButtonComboModule_ComboStatus *outStatus);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonCombo(ButtonComboModule_ComboHandle handle,
+                                                                            ButtonComboModule_Buttons combo,
+                                                                            ButtonComboModule_ComboStatus *outStatus);
 
 /**
 * @brief Updates the hold duration for a "Hold" combo.
@@ -394,8 +504,8 @@ ButtonComboModule_Error ButtonComboModule_UpdateButtonCombo(ButtonComboModule_Co
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_UpdateHoldDuration(ButtonComboModule_ComboHandle handle,
-                                                             uint32_t holdDurationInMs);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateHoldDuration(ButtonComboModule_ComboHandle handle,
+                                                                             uint32_t holdDurationInMs);
 
 /**
 * @brief Retrieves the metadata (label) for a specific combo.
@@ -408,8 +518,50 @@ ButtonComboModule_Error ButtonComboModule_UpdateHoldDuration(ButtonComboModule_C
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_GetButtonComboMeta(ButtonComboModule_ComboHandle handle,
-                                                             ButtonComboModule_MetaOptionsOut *outOptions);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboMeta(ButtonComboModule_ComboHandle handle,
+                                                                             ButtonComboModule_MetaOptionsOut *outOptions);
+
+/**
+* @brief Retrieves the label of a combo without copying it.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The module interns labels, identical labels share the same storage. The returned pointer stays valid (and can be
+* compared as a label ID) until the label is updated or the combo is removed. Read it from the thread that owns the
+* combo.
+*
+* @param[in]  handle    The handle of the combo. Must not be NULL.
+* @param[out] outLabel  Storage for a pointer to the NUL-terminated label. Must not be NULL.
+* @param[out] outLength Storage for the length of the label, excluding the NUL terminator. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Label retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outLabel/outLength is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboLabel(ButtonComboModule_ComboHandle handle,
+                                                                              const char **outLabel,
+                                                                              uint32_t *outLength);
+
+/**
+* @brief Retrieves the length of the label of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* A buffer of `*outLength + 1` bytes is large enough for @ref ButtonComboModule_GetButtonComboMeta.
+*
+* @param[in]  handle    The handle of the combo. Must not be NULL.
+* @param[out] outLength Storage for the length of the label, excluding the NUL terminator. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Length retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outLength is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboLabelLength(ButtonComboModule_ComboHandle handle,
+                                                                                    uint32_t *outLength);
 
 /**
 * @brief Retrieves the callback options for a specific combo.
@@ -424,14 +576,36 @@ ButtonComboModule_Error ButtonComboModule_GetButtonComboMeta(ButtonComboModule_C
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_GetButtonComboCallback(ButtonComboModule_ComboHandle handle,
-                                                                 ButtonComboModule_CallbackOptions *outOptions);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboCallback(ButtonComboModule_ComboHandle handle,
+                                                                                 ButtonComboModule_CallbackOptions *outOptions);
+
+/**
+* @brief Retrieves the extended callback of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* If the combo has been added with a @ref ButtonComboModule_ComboCallbackEx, that callback is called instead of the
+* one returned by @ref ButtonComboModule_GetButtonComboCallback, with the same context.
+*
+* @param[in]  handle        The handle of the combo. Must not be NULL.
+* @param[out] outCallbackEx Storage for the extended callback, set to NULL if the combo doesn't use one. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Callback retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outCallbackEx is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboCallbackEx(ButtonComboModule_ComboHandle handle,
+                                                                                   ButtonComboModule_ComboCallbackEx *outCallbackEx);
 
 /**
 * @brief Retrieves detailed info (type, mask, buttons, duration) for a specific combo.
 *
 * **Requires ButtonComboModule API version 1 or higher.**
 *
+* The trigger filter is not part of the info, see @ref ButtonComboModule_GetTriggerFilter.
+*
 * @param[in]  handle     The handle of the combo. Must not be NULL.
 * @param[out] outOptions Storage for the detailed info. Must not be NULL.
 *
@@ -440,8 +614,8 @@ ButtonComboModule_Error ButtonComboModule_GetButtonComboCallback(ButtonComboModu
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_GetButtonComboInfoEx(ButtonComboModule_ComboHandle handle,
-                                                               ButtonComboModule_ButtonComboInfoEx *outOptions);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboInfoEx(ButtonComboModule_ComboHandle handle,
+                                                                               ButtonComboModule_ButtonComboInfoEx *outOptions);
 
 /**
 * @brief Checks if a proposed combo would cause a conflict.
@@ -458,8 +632,262 @@ ButtonComboModule_Error ButtonComboModule_GetButtonComboInfoEx(ButtonComboModule
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_CheckComboAvailable(const ButtonComboModule_ButtonComboOptions *options,
-                                                              ButtonComboModule_ComboStatus *outStatus);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_CheckComboAvailable(const ButtonComboModule_ButtonComboOptions *options,
+                                                                              ButtonComboModule_ComboStatus *outStatus);
+
+/**
+* @brief Lists the registered combos that a proposed combo would conflict with.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Explains a CONFLICT status of @ref ButtonComboModule_CheckComboAvailable or @ref ButtonComboModule_AddButtonCombo,
+* so the caller can resolve it in one step instead of trying other combos. Observers are never listed because they
+* don't cause conflicts.
+*
+* @param[in]  options      The proposed combo options (mask and buttons). Must not be NULL.
+* @param[out] outConflicts Storage for up to maxCount conflicts. Must not be NULL if maxCount is not 0.
+* @param[in]  maxCount     Maximum number of conflicts to write.
+* @param[out] outCount     Storage for the total number of conflicts, may be larger than maxCount. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Conflicts listed. outCount is 0 if the combo is available.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    options/outCount is NULL, outConflicts is NULL or options contain invalid values.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboConflicts(const ButtonComboModule_ButtonComboOptions *options,
+                                                                            ButtonComboModule_ConflictInfo *outConflicts,
+                                                                            uint32_t maxCount,
+                                                                            uint32_t *outCount);
+
+/**
+* @brief Lists the registered combos that block an added combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Same as @ref ButtonComboModule_GetComboConflicts, but for a combo that has already been added, e.g. one with the
+* status CONFLICT. The combo itself is never listed. Also supports expression combos.
+*
+* @param[in]  handle       The handle of the combo. Must not be NULL.
+* @param[out] outConflicts Storage for up to maxCount conflicts. Must not be NULL if maxCount is not 0.
+* @param[in]  maxCount     Maximum number of conflicts to write.
+* @param[out] outCount     Storage for the total number of conflicts, may be larger than maxCount. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Conflicts listed. outCount is 0 if the combo is VALID.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outCount is NULL, outConflicts is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboConflicts(ButtonComboModule_ComboHandle handle,
+                                                                                  ButtonComboModule_ConflictInfo *outConflicts,
+                                                                                  uint32_t maxCount,
+                                                                                  uint32_t *outCount);
+
+/**
+* @brief Suggests combos that are currently free, e.g. to offer them in a binding UI.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Replaces probing candidates one by one with @ref ButtonComboModule_CheckComboAvailable. The module computes the
+* suggestions against its index of the current registrations, so this is a single call regardless of how many combos
+* are registered.
+*
+* Every suggested combo consists of 1 to `options->maxChordSize` buttons of `options->allowedButtons` and would
+* be VALID on all controllers of `options->controllerMask`. Smaller combos are suggested first.
+*
+* @param[in]  options   The controllers and buttons to consider. Must not be NULL.
+* @param[out] outCombos Storage for up to maxCount combos. Must not be NULL if maxCount is not 0.
+* @param[in]  maxCount  Maximum number of combos to suggest.
+* @param[out] outCount  Storage for the number of combos written to outCombos. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Suggestions computed. outCount may be 0 if no combo is free.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    options/outCount is NULL, outCombos is NULL, or options contain invalid values (e.g. empty mask, 0 chord size).
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SuggestFreeCombos(const ButtonComboModule_SuggestComboOptions *options,
+                                                                            ButtonComboModule_Buttons *outCombos,
+                                                                            uint32_t maxCount,
+                                                                            uint32_t *outCount);
+
+/**
+* @brief Copies all combos that are registered system-wide into a single buffer.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Includes the combos of all clients, e.g. to show which plugin owns a conflicting combo. The buffer starts with a
+* @ref ButtonComboModule_SnapshotHeader, followed by the @ref ButtonComboModule_SnapshotEntry entries and a string pool
+* with the labels and owner names. Use `ButtonComboModule::ComboSnapshotView` to iterate it from C++.
+*
+* If the buffer is too small, nothing is copied. Call it with a NULL buffer to query the required size first, combos
+* may be added between two calls.
+*
+* @param[out] buffer          Storage for the snapshot, must be 4-byte aligned. Can be NULL if bufferSize is 0.
+* @param[in]  bufferSize      Size of the buffer in bytes.
+* @param[out] outRequiredSize Storage for the size of the full snapshot in bytes. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The snapshot has been copied.
+* @retval BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL    The buffer is too small, outRequiredSize has been set.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    outRequiredSize is NULL, or buffer is NULL or not aligned.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboSnapshot(void *buffer,
+                                                                           uint32_t bufferSize,
+                                                                           uint32_t *outRequiredSize);
+
+/**
+* @brief Copies the most recent input sample of the given controllers.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Returns the samples the module has already read for its combo checks, e.g. to show the held buttons of the
+* controller that triggered a combo or an on-screen input display. Doesn't read or consume any input, so the samples
+* stay available to the running application. The states are written in the order of the controller bits, VPAD_0 first.
+*
+* @param[in]  controllerMask The controllers to copy. Must not be empty.
+* @param[out] outStates      Storage for up to maxCount states. Must not be NULL if maxCount is not 0.
+* @param[in]  maxCount       Maximum number of states to write. @ref BUTTON_COMBO_MODULE_CONTROLLER_COUNT is always enough.
+* @param[out] outCount       Storage for the number of states written to outStates. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             States copied.
+* @retval BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL    maxCount is smaller than the number of controllers in the mask, the first maxCount states have been copied.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    outCount is NULL, outStates is NULL or the mask is empty or invalid.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetControllerStates(ButtonComboModule_ControllerTypes controllerMask,
+                                                                              ButtonComboModule_ControllerState *outStates,
+                                                                              uint32_t maxCount,
+                                                                              uint32_t *outCount);
+
+/**
+* @brief Feeds synthetic input samples into the combo evaluation, e.g. for automated tests or macros.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The samples are evaluated in order, exactly like real input: hold durations, press down, observers and conflicts
+* behave the same, and @ref ButtonComboModule_GetControllerStates returns the injected buttons. All combos of all
+* clients see the samples. The callbacks of the triggered combos are called before this function returns.
+*
+* Real input of the same controller is evaluated as well, use @ref ButtonComboModule_SetRealInputMask to ignore it
+* while the injection runs.
+*
+* @param[in] samples The samples to evaluate. Must not be NULL.
+* @param[in] count   Number of samples. Must not be 0.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             All samples have been evaluated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    samples is NULL, count is 0 or a sample doesn't have exactly one controller. No sample has been evaluated.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_InjectInput(const ButtonComboModule_InputSample *samples,
+                                                                      uint32_t count);
+
+/**
+* @brief Ignores the real input of some controllers, so only injected input is evaluated for them.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The mask applies to the whole module and replaces the previous mask. Pass BUTTON_COMBO_MODULE_CONTROLLER_NONE to evaluate real input again.
+* Use @ref ButtonComboModule_GetRealInputMask to restore the previous mask afterwards.
+*
+* @param[in] controllerMask The controllers whose real input is ignored.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The mask has been set.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    The mask is invalid.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetRealInputMask(ButtonComboModule_ControllerTypes controllerMask);
+
+/**
+* @brief Retrieves the mask set via @ref ButtonComboModule_SetRealInputMask, possibly by another client.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* @param[out] outControllerMask Storage for the controllers whose real input is ignored. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The mask has been retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    outControllerMask is NULL.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetRealInputMask(ButtonComboModule_ControllerTypes *outControllerMask);
+
+/**
+* @brief Starts recording the state transitions of all combos into a ring buffer, e.g. to profile hold latencies.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Every transition of a combo on a controller (see @ref ButtonComboModule_TimelineState) is written to the recorder,
+* including the combos of other clients. Recording never allocates, once the buffer is full the oldest events are
+* overwritten. Each client can have one recorder, starting a new recording replaces the previous one.
+*
+* Read the events after @ref ButtonComboModule_StopTimelineRecording, e.g. via @ref ButtonComboModule_WriteTimelineDump.
+*
+* @param[in,out] recorder The ring buffer. `totalCount` is reset to 0 and `recording` is set until the recording has
+*                         been stopped or replaced. Must not be NULL, must have a capacity and must stay valid until
+*                         the recording has been stopped.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The recording has been started.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    recorder or recorder->events is NULL, or the capacity is 0.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_StartTimelineRecording(ButtonComboModule_TimelineRecorder *recorder);
+
+/**
+* @brief Stops the recording of this client. The module clears `recording` of the recorder and doesn't touch it
+* anymore once this returns.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Called by @ref ButtonComboModule_DeInitLibrary as well.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The recording has been stopped or wasn't running.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_StopTimelineRecording(void);
+
+/**
+* @brief Serializes a stopped recording into a self-contained dump that can be written to a file.
+*
+* The dump starts with a @ref ButtonComboModule_TimelineDumpHeader, followed by the events (oldest first) and the
+* labels of the recorded combos. Labels are looked up while writing the dump, they are empty for combos that have been
+* removed in the meantime or belong to other clients. Convert the dump to the Chrome trace event format with
+* `ButtonComboModule::WriteChromeTrace` or with the host tool in `tools/`.
+*
+* If the buffer is too small, nothing is written. Call it with a NULL buffer to query the required size first.
+* Every call allocates temporary storage for one entry per event and sorts the recorded combos, so the size query and
+* the actual write do this work twice. Size the buffer generously to write the dump with a single call.
+*
+* @param[in]  recorder        The recorder. Must not be NULL and must not be recording, see
+*                             @ref ButtonComboModule_StopTimelineRecording.
+* @param[out] buffer          Storage for the dump, must be 8-byte aligned. Can be NULL if bufferSize is 0.
+* @param[in]  bufferSize      Size of the buffer in bytes.
+* @param[out] outRequiredSize Storage for the size of the dump in bytes. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS          The dump has been written.
+* @retval BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL The buffer is too small, outRequiredSize has been set.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT recorder or outRequiredSize is NULL, buffer is NULL or not aligned,
+*                                                   or the recorder is still recording.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR    The temporary storage couldn't be allocated.
+*/
+ButtonComboModule_Error ButtonComboModule_WriteTimelineDump(const ButtonComboModule_TimelineRecorder *recorder,
+                                                            void *buffer,
+                                                            uint32_t bufferSize,
+                                                            uint32_t *outRequiredSize);
 
 /**
 * @brief Blocks execution until a specific combo (or abort combo) is detected.
@@ -480,8 +908,514 @@ ButtonComboModule_Error ButtonComboModule_CheckComboAvailable(const ButtonComboM
 * @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
 * @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
 */
-ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions *options,
-                                                                     ButtonComboModule_Buttons *outButtons);
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions *options,
+                                                                                     ButtonComboModule_Buttons *outButtons);
+
+/**
+* @brief Starts detecting a button combo without blocking the calling thread.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Behaves like @ref ButtonComboModule_DetectButtonCombo_Blocking, but returns immediately. Once a combo (or the
+* abort combo) has been detected, `callback` is called exactly once from the module's input thread.
+*
+* @param[in] options  Configuration for detection (mask, durations, abort buttons). Must not be NULL. Copied by the module.
+* @param[in] callback Function to call with the detection result. Must not be NULL.
+* @param[in] context  User data passed to the callback. Can be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The detection has been started.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    options/callback is NULL, or options contain invalid values.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Async(const ButtonComboModule_DetectButtonComboOptions *options,
+                                                                                  ButtonComboModule_DetectButtonComboCallback callback,
+                                                                                  void *context);
+
+/**
+* @brief Registers a callback that receives all combo triggers of an input frame at once.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* While a batch callback is set, the module doesn't call the callbacks of the combos added by this client anymore.
+* Instead, all triggers of an input frame are collected and passed to `callback` with a single call, e.g. to take a
+* lock only once per frame. Combos using a @ref ButtonComboModule_ComboCallbackEx are not affected.
+*
+* Use @ref ButtonComboModule_DispatchTriggerRecords to forward the records to the per-combo callbacks.
+*
+* @param[in] callback Function to call once per input frame with at least one trigger. NULL restores the per-combo callbacks.
+* @param[in] context  User data passed to the callback. Can be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The batch callback has been updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetBatchCallback(ButtonComboModule_BatchCallback callback,
+                                                                           void *context);
+
+/**
+* @brief Calls the per-combo callback of each record.
+*
+* Can be passed to @ref ButtonComboModule_SetBatchCallback directly, or be called from a custom batch callback.
+* Records without a callback are skipped.
+*
+* @param[in] records Array of trigger records. Can be NULL if count is 0.
+* @param[in] count   Number of records in the array.
+* @param[in] context Unused.
+*/
+void ButtonComboModule_DispatchTriggerRecords(const ButtonComboModule_TriggerRecord *records, uint32_t count, void *context);
+
+/**
+* @brief Updates the cooldown and debounce time of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Triggers that are filtered out are suppressed by the module before any callback is dispatched and are counted,
+* see @ref ButtonComboModule_GetSuppressedTriggerCount.
+*
+* @param[in] handle       The handle of the combo. Must not be NULL.
+* @param[in] cooldownInMs Minimum time between two triggers. 0 disables the cooldown.
+* @param[in] debounceInMs How long the combo has to be released before it may trigger again. 0 disables debouncing.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Filter updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateTriggerFilter(ButtonComboModule_ComboHandle handle,
+                                                                              uint32_t cooldownInMs,
+                                                                              uint32_t debounceInMs);
+
+/**
+* @brief Retrieves how many triggers of a combo have been suppressed by its cooldown or debounce time.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* @param[in]  handle   The handle of the combo. Must not be NULL.
+* @param[out] outCount Storage for the number of suppressed triggers. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Count retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outCount is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetSuppressedTriggerCount(ButtonComboModule_ComboHandle handle,
+                                                                                    uint32_t *outCount);
+
+/**
+* @brief Retrieves the cooldown and debounce time of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* @param[in]     handle    The handle of the combo. Must not be NULL.
+* @param[in,out] outFilter Storage for the filter. Must not be NULL, `version` has to be set to
+*                          @ref BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION. Only the fields of that version are written.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS                      Filter retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT             handle/outFilter is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION outFilter->version is not supported.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED            The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND          The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR                Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetTriggerFilter(ButtonComboModule_ComboHandle handle,
+                                                                           ButtonComboModule_TriggerFilter *outFilter);
+
+/**
+* @brief Hands the callback of a combo off to an executor.
+*
+* **Requires ButtonComboModule API version 1 or higher.**
+*
+* Replaces the callback of the combo with a trampoline that passes every trigger to `executor->post` instead of
+* calling the callback on the module's input thread. The executor decides where the original callback runs, e.g. on
+* an app-owned worker, a thread pinned to a specific core or from a per-frame pump.
+* Triggers rejected by the executor are dropped and counted in `outBinding->droppedCount`.
+* Combos that use a @ref ButtonComboModule_ComboCallbackEx can't be bound.
+*
+* @param[in]  handle     The handle of the combo. Must not be NULL.
+* @param[in]  executor   The executor to use. Must not be NULL. Copied into outBinding.
+* @param[out] outBinding Storage for the binding. Must not be NULL and must stay valid until the combo has been
+*                        removed, also if @ref ButtonComboModule_UnbindExecutor has been called before.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combo has been bound to the executor.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/executor/outBinding is NULL, or executor->post is NULL.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The combo uses a @ref ButtonComboModule_ComboCallbackEx.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+ButtonComboModule_Error ButtonComboModule_BindExecutor(ButtonComboModule_ComboHandle handle,
+                                                       const ButtonComboModule_Executor *executor,
+                                                       ButtonComboModule_ExecutorBinding *outBinding);
+
+/**
+* @brief Restores the original callback of a combo that has been bound to an executor.
+*
+* **Requires ButtonComboModule API version 1 or higher.**
+*
+* Waits until triggers that are currently being posted have returned from the executor. Must not be called from within
+* the post function of the executor.
+*
+* @warning This doesn't end the lifetime of the binding. The module may have read the trampoline and its context right
+* before the callback was restored and call it after this function has returned, so the binding has to stay valid until
+* the combo has been removed. Triggers that have already been posted are not affected either, they keep the context of
+* the original callback until the executor runs or discards them.
+*
+* @param[in] binding The binding filled by @ref ButtonComboModule_BindExecutor. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS            The original callback has been restored.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT   binding is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
+*/
+ButtonComboModule_Error ButtonComboModule_UnbindExecutor(ButtonComboModule_ExecutorBinding *binding);
+
+/**
+* @brief Routes the callback of a combo through a slot that can be swapped without stalling the input thread.
+*
+* **Requires ButtonComboModule API version 1 or higher.**
+*
+* @ref ButtonComboModule_UpdateButtonComboCallback gives no guarantee about triggers that are dispatched at the same
+* time, so the old context can't be released safely. After installing a slot, use @ref ButtonComboModule_SwapCallback
+* instead: a trigger always sees a consistent callback/context pair and never waits for a swap.
+* Combos that use a @ref ButtonComboModule_ComboCallbackEx can't get a slot.
+*
+* @param[in]  handle  The handle of the combo. Must not be NULL.
+* @param[out] outSlot Storage for the slot, initialized with the current callback of the combo. Must not be NULL and
+*                     must stay valid until the combo has been removed, also if
+*                     @ref ButtonComboModule_UninstallCallbackSlot has been called before.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The slot has been installed.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outSlot is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The combo uses a @ref ButtonComboModule_ComboCallbackEx.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+ButtonComboModule_Error ButtonComboModule_InstallCallbackSlot(ButtonComboModule_ComboHandle handle,
+                                                              ButtonComboModule_CallbackSlot *outSlot);
+
+/**
+* @brief Atomically publishes a new callback/context pair for a combo with an installed slot.
+*
+* Triggers that start after the swap see the new pair. Returns once all dispatches that are still using the old pair
+* have finished, the old context can be released afterwards.
+*
+* @warning Must not be called from the callback of the same combo, this would wait for itself.
+*
+* @param[in]  slot            The slot filled by @ref ButtonComboModule_InstallCallbackSlot. Must not be NULL.
+* @param[in]  callbackOptions The new callback and context. Must not be NULL.
+* @param[out] outOldOptions   Storage for the replaced pair. Can be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS            The new pair has been published.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT   slot/callbackOptions is NULL.
+*/
+ButtonComboModule_Error ButtonComboModule_SwapCallback(ButtonComboModule_CallbackSlot *slot,
+                                                       const ButtonComboModule_CallbackOptions *callbackOptions,
+                                                       ButtonComboModule_CallbackOptions *outOldOptions);
+
+/**
+* @brief Passes the current callback of the slot back to the module and removes the slot.
+*
+* **Requires ButtonComboModule API version 1 or higher.**
+*
+* Waits until dispatches that are currently using the slot have returned. The slot must not be swapped afterwards.
+*
+* @warning This doesn't end the lifetime of the slot. Unlike @ref ButtonComboModule_SwapCallback, it can't wait for a
+* trigger for which the module has read the trampoline and its context right before the callback was restored, and
+* which enters the slot after this function has returned. The slot has to stay valid until the combo has been removed.
+*
+* @param[in] slot The slot filled by @ref ButtonComboModule_InstallCallbackSlot. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS            The slot has been removed.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT   slot is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED  The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR      Internal module error.
+*/
+ButtonComboModule_Error ButtonComboModule_UninstallCallbackSlot(ButtonComboModule_CallbackSlot *slot);
+
+/**
+* @brief Retrieves module-wide runtime statistics.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Includes the number of registered combos, the memory used for them, how long the module takes to evaluate an
+* input frame and how many callbacks exceeded the budget set with @ref ButtonComboModule_SetCallbackBudget.
+* Cheap enough to be polled once per second.
+*
+* @param[in,out] outStats Storage for the statistics. Must not be NULL. `version` has to be set to
+*                         BUTTON_COMBO_MODULE_STATS_VERSION.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS                      Statistics retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT             outStats is NULL.
+* @retval BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION outStats->version is not supported.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED            The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND          The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR                Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetStats(ButtonComboModule_Stats *outStats);
+
+/**
+* @brief Sets how long a single combo callback may run before it is counted as over budget.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The budget is module-wide. Callbacks are never interrupted, they are only counted in
+* `ButtonComboModule_Stats::callbacksOverBudget`.
+*
+* @param[in] budgetInUs The budget in microseconds. 0 disables the check.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Budget updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetCallbackBudget(uint32_t budgetInUs);
+
+/**
+* @brief Creates an empty combo group that is enabled.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Groups allow enabling and disabling several combos with a single call, e.g. when switching between app modes.
+* Disabling keeps the registrations and handles of the combos, but they are neither checked nor considered for
+* conflicts until the group is enabled again.
+*
+* @param[out] outGroup Storage for the group handle. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The group has been created.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    outGroup is NULL.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_CreateComboGroup(ButtonComboModule_ComboGroupHandle *outGroup);
+
+/**
+* @brief Destroys a combo group. The combos of the group stay registered and are enabled.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* @param[in] group The group to destroy. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The group has been destroyed or was not found.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    group is NULL.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DestroyComboGroup(ButtonComboModule_ComboGroupHandle group);
+
+/**
+* @brief Assigns a combo to a group.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* A combo can only be part of one group, it's moved if it's already assigned to a different group. The combo is
+* enabled or disabled according to the state of the group. Removing the combo removes it from the group as well.
+*
+* @param[in] group  The group. Must not be NULL.
+* @param[in] handle The handle of the combo. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combo has been assigned to the group.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    group/handle is NULL or **group/handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_AddToComboGroup(ButtonComboModule_ComboGroupHandle group,
+                                                                          ButtonComboModule_ComboHandle handle);
+
+/**
+* @brief Removes a combo from a group. The combo stays registered and is enabled.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* @param[in] group  The group. Must not be NULL.
+* @param[in] handle The handle of the combo. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combo has been removed from the group or was not part of it.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    group/handle is NULL or **group not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveFromComboGroup(ButtonComboModule_ComboGroupHandle group,
+                                                                               ButtonComboModule_ComboHandle handle);
+
+/**
+* @brief Enables or disables all combos of a group at once.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Disabled combos have the status BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED. When enabling a group, conflicts are
+* re-checked for all its combos, use @ref ButtonComboModule_GetButtonComboStatus to get the new status.
+*
+* @param[in] group   The group. Must not be NULL.
+* @param[in] enabled true to enable the combos of the group, false to disable them.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The group has been updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    group is NULL or **group not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetComboGroupEnabled(ButtonComboModule_ComboGroupHandle group,
+                                                                               bool enabled);
+
+/**
+* @brief Suspends or resumes all combos of this client.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Suspended combos are not checked and their callbacks are not called, but unlike disabled combos they keep their
+* status and still block conflicting combos of other clients. Resuming doesn't re-check conflicts, so every combo is
+* back exactly as it was. Combos that are added while the client is suspended are suspended as well.
+* Independent of combo groups, use @ref ButtonComboModule_SetButtonComboSuspendExempt to keep single combos running.
+*
+* @param[in] suspended true to suspend the combos, false to resume them.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combos have been suspended or resumed.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetClientSuspended(bool suspended);
+
+/**
+* @brief Keeps a combo running while its client is suspended.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Takes effect immediately, also while the client is suspended.
+*
+* @param[in] handle The handle of the combo. Must not be NULL.
+* @param[in] exempt true to keep the combo running, false to suspend it together with its client.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The combo has been updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetButtonComboSuspendExempt(ButtonComboModule_ComboHandle handle,
+                                                                                      bool exempt);
+
+/**
+* @brief Replaces the expression of a combo and re-checks conflicts.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* Can be used for plain combos as well, they become expression combos.
+*
+* @param[in]  handle     The handle of the combo. Must not be NULL.
+* @param[in]  expression The new expression. Must not be NULL.
+* @param[out] outStatus  (Optional) Storage for the new status.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Expression updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/expression is NULL, **handle not found** or the expression is empty.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateComboExpression(ButtonComboModule_ComboHandle handle,
+                                                                                const ButtonComboModule_ComboExpression *expression,
+                                                                                ButtonComboModule_ComboStatus *outStatus);
+
+/**
+* @brief Retrieves the expression of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* For plain combos, `required` is set to the combo and all other masks are empty.
+*
+* @param[in]  handle        The handle of the combo. Must not be NULL.
+* @param[out] outExpression Storage for the expression. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Expression retrieved.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/outExpression is NULL or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboExpression(ButtonComboModule_ComboHandle handle,
+                                                                             ButtonComboModule_ComboExpression *outExpression);
+
+/**
+* @brief Updates the thresholds of the virtual stick direction buttons of a combo.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The stick directions (e.g. @ref BCMPAD_BUTTON_STICK_R_UP) can be used like any other button, in all combo types,
+* and take part in conflict checks. They are evaluated in the same input pass as the buttons, so there is no need to
+* read the sticks separately. On Wiimotes, the left stick is the stick of the Nunchuk or Classic Controller.
+* Until this is called, the defaults of @ref ButtonComboModule_StickDirectionOptions are used.
+*
+* @param[in] handle  The handle of the combo. Must not be NULL.
+* @param[in] options The new thresholds. Must not be NULL.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             Thresholds updated.
+* @retval BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT    handle/options is NULL, the thresholds are out of range or **handle not found**.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support this command.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateStickDirectionOptions(ButtonComboModule_ComboHandle handle,
+                                                                                      const ButtonComboModule_StickDirectionOptions *options);
+
+/**
+* @brief Converts stick positions into the virtual stick direction buttons.
+*
+* Reference implementation of the thresholds described in @ref ButtonComboModule_StickDirectionOptions, e.g. to show
+* the pushed directions in a binding UI. Doesn't need the module.
+*
+* @param[in] options  The thresholds. Uses the defaults if NULL.
+* @param[in] leftX    Horizontal position of the left stick, -1.0 (left) to 1.0 (right).
+* @param[in] leftY    Vertical position of the left stick, -1.0 (down) to 1.0 (up).
+* @param[in] rightX   Horizontal position of the right stick.
+* @param[in] rightY   Vertical position of the right stick.
+* @param[in] previous The result of the previous sample, used for the hysteresis. Other buttons are ignored.
+*
+* @return The pushed stick directions.
+*/
+ButtonComboModule_Buttons ButtonComboModule_GetStickDirectionButtons(const ButtonComboModule_StickDirectionOptions *options,
+                                                                     float leftX,
+                                                                     float leftY,
+                                                                     float rightX,
+                                                                     float rightY,
+                                                                     ButtonComboModule_Buttons previous);
+
+/**
+* @brief Suspends the combos of this client while the app is in the background.
+*
+* **Requires ButtonComboModule API version 2 or higher.**
+*
+* The library registers ProcUI callbacks that suspend this client via @ref ButtonComboModule_SetClientSuspended when
+* the app releases the foreground, and resume it when the foreground is acquired again. Handles and statuses are kept,
+* no conflicts are re-checked on resume, and combo groups are not touched.
+*
+* This applies to all combos of this client, ButtonCombo objects and C handles alike, including the ones that are
+* added later on. Use `ButtonCombo::SetForegroundLifecycleExempt` or @ref ButtonComboModule_SetButtonComboSuspendExempt
+* to keep single combos running.
+*
+* Disabling the mode or deinitializing the library resumes the combos.
+*
+* @note Must be called after `ProcUIInit`. The callbacks are lost if the app calls `ProcUIClearCallbacks`.
+*
+* @param[in] enabled true to enable the mode, false to disable it.
+*
+* @retval BUTTON_COMBO_MODULE_ERROR_SUCCESS             The mode has been enabled or disabled.
+* @retval BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED   The library is not initialized.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND The loaded module does not support suspending clients.
+* @retval BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR       Internal module error.
+*/
+ButtonComboModule_Error ButtonComboModule_SetForegroundLifecycleEnabled(bool enabled);
+
+#ifdef BUTTONCOMBO_INLINE
+#include "api_inline.h"
+#endif
 
 #ifdef __cplusplus
 }
@@ -489,18 +1423,44 @@ ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Blocking(const Butto
 
 #ifdef __cplusplus
 
+#include <stddef.h>
+
+/**
+ * The thin wrappers once more, as C++ inline functions for the inline methods and templates of the C++ API. Unlike the
+ * C functions, they are the same entities in every translation unit whether `BUTTONCOMBO_INLINE` is defined or not, so
+ * mixing both modes doesn't give the C++ API two different definitions.
+ */
+namespace ButtonComboModule::detail {
+#pragma push_macro("BUTTONCOMBO_API")
+#undef BUTTONCOMBO_API
+#define BUTTONCOMBO_API inline
+#include "api_inline.h"
+#pragma pop_macro("BUTTONCOMBO_API")
+} // namespace ButtonComboModule::detail
+
+#include <algorithm>
 #include <buttoncombo/ButtonCombo.h>
+#include <buttoncombo/ButtonComboSnapshot.h>
+#include <buttoncombo/expected.h>
+#include <buttoncombo/inplace_vector.h>
 #include <optional>
-#include <stdexcept>
+#include <span>
 #include <string_view>
 
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
+#include <stdexcept>
+#endif
+
 /**
  * @namespace ButtonComboModule
  * @brief C++ RAII wrapper API.
  *
  * This namespace provides a safer, object-oriented interface for the ButtonComboModule.
- * Most functions here are wrappers around the C API, returning `std::optional` or throwing exceptions
+ * Most functions here are wrappers around the C API, returning `std::optional`, `expected` or throwing exceptions
  * instead of returning raw error codes.
+ *
+ * The throwing overloads are not available if exceptions are disabled (or `BUTTONCOMBO_NO_EXCEPTIONS` is defined).
+ * Link against `libbuttoncombo_noexcept.a` in that case.
  */
 namespace ButtonComboModule {
     /**
@@ -518,6 +1478,11 @@ namespace ButtonComboModule {
      */
     const char *GetComboStatusStr(ButtonComboModule_ComboStatus status);
 
+    /**
+     * @brief Wrapper for @ref ButtonComboModule_GetConflictKindStr.
+     */
+    const char *GetConflictKindStr(ButtonComboModule_ConflictKind kind);
+
     /**
      * @brief Creates a button combo (Generic).
      *
@@ -586,6 +1551,50 @@ namespace ButtonComboModule {
                                                             ButtonComboModule_ComboStatus &outStatus,
                                                             ButtonComboModule_Error &outError) noexcept;
 
+    /**
+     * @brief Creates a "Press Down" combo with a cooldown and/or debounce time.
+     *
+     * Refer to @ref ButtonComboModule_AddButtonComboPressDownFiltered for parameter details.
+     * @sa ButtonComboModule_AddButtonComboPressDownFiltered
+     */
+    std::optional<ButtonCombo> CreateComboPressDownFiltered(std::string_view label,
+                                                            ButtonComboModule_ControllerTypes controllerMask,
+                                                            ButtonComboModule_Buttons combo,
+                                                            uint32_t cooldownInMs,
+                                                            uint32_t debounceInMs,
+                                                            ButtonComboModule_ComboCallback callback,
+                                                            void *context,
+                                                            bool observer,
+                                                            ButtonComboModule_ComboStatus &outStatus,
+                                                            ButtonComboModule_Error &outError) noexcept;
+
+    /**
+     * @brief Creates an expression combo.
+     *
+     * Refer to @ref ButtonComboModule_AddButtonComboExpression for parameter details.
+     * @sa ButtonComboModule_AddButtonComboExpression
+     */
+    std::optional<ButtonCombo> CreateComboExpression(std::string_view label,
+                                                     ButtonComboModule_ControllerTypes controllerMask,
+                                                     const ButtonComboModule_ComboExpression &expression,
+                                                     uint32_t holdDurationInMs,
+                                                     ButtonComboModule_ComboCallback callback,
+                                                     void *context,
+                                                     bool observer,
+                                                     ButtonComboModule_ComboStatus &outStatus,
+                                                     ButtonComboModule_Error &outError) noexcept;
+
+    /**
+     * @brief Returns an expression that only matches if exactly the given buttons are held.
+     *
+     * Only the other physical buttons are forbidden, tilting a stick doesn't prevent the combo from triggering.
+     */
+    constexpr ButtonComboModule_ComboExpression ExactComboExpression(const ButtonComboModule_Buttons combo) {
+        return {.required  = combo,
+                .anyOf     = {},
+                .forbidden = static_cast<ButtonComboModule_Buttons>(BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & ~static_cast<uint32_t>(combo))};
+    }
+
     /**
      * @brief Creates a "Hold" combo.
      *
@@ -642,6 +1651,118 @@ namespace ButtonComboModule {
                                                        ButtonComboModule_ComboStatus &outStatus,
                                                        ButtonComboModule_Error &outError) noexcept;
 
+    /**
+     * @brief Creates a button combo (Generic, Non-throwing).
+     *
+     * @details Same as @ref CreateComboEx, but reports errors through the returned `expected`.
+     *
+     * @param options        Configuration options (see @ref ButtonComboModule_ComboOptions).
+     * @param[out] outStatus Resulting status (VALID or CONFLICT).
+     * @return A `ButtonCombo` object on success, or the error code on failure.
+     * @sa ButtonComboModule_AddButtonCombo
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboEx(const ButtonComboModule_ComboOptions &options,
+                                                                    ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Press Down" combo (Non-throwing).
+     *
+     * @details Same as @ref CreateComboPressDownEx, but reports errors through the returned `expected`.
+     * @sa ButtonComboModule_AddButtonComboPressDownEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownEx(std::string_view label,
+                                                                             ButtonComboModule_ControllerTypes controllerMask,
+                                                                             ButtonComboModule_Buttons combo,
+                                                                             ButtonComboModule_ComboCallback callback,
+                                                                             void *context,
+                                                                             bool observer,
+                                                                             ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Press Down" combo on ALL controllers (Conflict Checked, Non-throwing).
+     * @sa TryCreateComboPressDownEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDown(std::string_view label,
+                                                                           ButtonComboModule_Buttons combo,
+                                                                           ButtonComboModule_ComboCallback callback,
+                                                                           void *context,
+                                                                           ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Press Down" combo on ALL controllers (Observer, Non-throwing).
+     * @sa TryCreateComboPressDownEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownObserver(std::string_view label,
+                                                                                   ButtonComboModule_Buttons combo,
+                                                                                   ButtonComboModule_ComboCallback callback,
+                                                                                   void *context,
+                                                                                   ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Press Down" combo with a cooldown and/or debounce time (Non-throwing).
+     * @sa CreateComboPressDownFiltered
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownFiltered(std::string_view label,
+                                                                                   ButtonComboModule_ControllerTypes controllerMask,
+                                                                                   ButtonComboModule_Buttons combo,
+                                                                                   uint32_t cooldownInMs,
+                                                                                   uint32_t debounceInMs,
+                                                                                   ButtonComboModule_ComboCallback callback,
+                                                                                   void *context,
+                                                                                   bool observer,
+                                                                                   ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates an expression combo (Non-throwing).
+     * @sa CreateComboExpression
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboExpression(std::string_view label,
+                                                                            ButtonComboModule_ControllerTypes controllerMask,
+                                                                            const ButtonComboModule_ComboExpression &expression,
+                                                                            uint32_t holdDurationInMs,
+                                                                            ButtonComboModule_ComboCallback callback,
+                                                                            void *context,
+                                                                            bool observer,
+                                                                            ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Hold" combo (Non-throwing).
+     *
+     * @details Same as @ref CreateComboHoldEx, but reports errors through the returned `expected`.
+     * @sa ButtonComboModule_AddButtonComboHoldEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHoldEx(std::string_view label,
+                                                                        ButtonComboModule_ControllerTypes controllerMask,
+                                                                        ButtonComboModule_Buttons combo,
+                                                                        uint32_t holdDurationInMs,
+                                                                        ButtonComboModule_ComboCallback callback,
+                                                                        void *context,
+                                                                        bool observer,
+                                                                        ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Hold" combo on ALL controllers (Conflict Checked, Non-throwing).
+     * @sa TryCreateComboHoldEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHold(std::string_view label,
+                                                                      ButtonComboModule_Buttons combo,
+                                                                      uint32_t holdDurationInMs,
+                                                                      ButtonComboModule_ComboCallback callback,
+                                                                      void *context,
+                                                                      ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+    /**
+     * @brief Creates a "Hold" combo on ALL controllers (Observer, Non-throwing).
+     * @sa TryCreateComboHoldEx
+     */
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHoldObserver(std::string_view label,
+                                                                              ButtonComboModule_Buttons combo,
+                                                                              uint32_t holdDurationInMs,
+                                                                              ButtonComboModule_ComboCallback callback,
+                                                                              void *context,
+                                                                              ButtonComboModule_ComboStatus &outStatus) noexcept;
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
     /**
      * @brief Creates a "Press Down" combo (Throwing).
      *
@@ -676,6 +1797,33 @@ namespace ButtonComboModule {
                                              void *context,
                                              ButtonComboModule_ComboStatus &outStatus);
 
+    /**
+     * @brief Creates a "Press Down" combo with a cooldown and/or debounce time (Throwing).
+     * @sa CreateComboPressDownFiltered
+     */
+    ButtonCombo CreateComboPressDownFiltered(std::string_view label,
+                                             ButtonComboModule_ControllerTypes controllerMask,
+                                             ButtonComboModule_Buttons combo,
+                                             uint32_t cooldownInMs,
+                                             uint32_t debounceInMs,
+                                             ButtonComboModule_ComboCallback callback,
+                                             void *context,
+                                             bool observer,
+                                             ButtonComboModule_ComboStatus &outStatus);
+
+    /**
+     * @brief Creates an expression combo (Throwing).
+     * @sa CreateComboExpression
+     */
+    ButtonCombo CreateComboExpression(std::string_view label,
+                                      ButtonComboModule_ControllerTypes controllerMask,
+                                      const ButtonComboModule_ComboExpression &expression,
+                                      uint32_t holdDurationInMs,
+                                      ButtonComboModule_ComboCallback callback,
+                                      void *context,
+                                      bool observer,
+                                      ButtonComboModule_ComboStatus &outStatus);
+
     /**
      * @brief Creates a "Hold" combo (Throwing).
      *
@@ -713,6 +1861,8 @@ namespace ButtonComboModule {
                                         void *context,
                                         ButtonComboModule_ComboStatus &outStatus);
 
+#endif
+
     /**
      * @brief Checks if a combo is available.
      *
@@ -722,6 +1872,65 @@ namespace ButtonComboModule {
     ButtonComboModule_Error CheckComboAvailable(const ButtonComboModule_ButtonComboOptions &options,
                                                 ButtonComboModule_ComboStatus &outStatus);
 
+    /**
+     * @brief Conflicts of a combo, stored inline without allocating.
+     */
+    template<size_t N = 8>
+    using ComboConflicts = inplace_vector<ButtonComboModule_ConflictInfo, N>;
+
+    /**
+     * @brief Lists the registered combos that a proposed combo would conflict with.
+     *
+     * Wrapper for @ref ButtonComboModule_GetComboConflicts. Returns BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL if there
+     * are more conflicts than fit into `outConflicts`, it still contains the first ones.
+     * @sa ButtonComboModule_GetComboConflicts
+     */
+    template<size_t N>
+    ButtonComboModule_Error GetComboConflicts(const ButtonComboModule_ButtonComboOptions &options,
+                                              ComboConflicts<N> &outConflicts) {
+        uint32_t count = 0;
+        outConflicts.resize(N);
+        const auto res = detail::ButtonComboModule_GetComboConflicts(&options, outConflicts.data(), N, &count);
+        outConflicts.resize(res == BUTTON_COMBO_MODULE_ERROR_SUCCESS ? std::min<size_t>(count, N) : 0);
+        if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS && count > N) {
+            return BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Suggests up to `outCombos.size()` free combos, smallest first.
+     *
+     * Wrapper for @ref ButtonComboModule_SuggestFreeCombos.
+     * @sa ButtonComboModule_SuggestFreeCombos
+     */
+    ButtonComboModule_Error SuggestFreeCombos(const ButtonComboModule_SuggestComboOptions &options,
+                                              std::span<ButtonComboModule_Buttons> outCombos,
+                                              uint32_t &outCount);
+
+    /**
+     * @brief Copies all combos that are registered system-wide into `buffer`.
+     *
+     * Wrapper for @ref ButtonComboModule_GetComboSnapshot. Use a @ref ComboSnapshotView to iterate the result.
+     * @sa ButtonComboModule_GetComboSnapshot
+     */
+    ButtonComboModule_Error GetComboSnapshot(std::span<uint32_t> buffer,
+                                             uint32_t &outRequiredSize);
+
+    /**
+     * @brief The most recent input samples of up to all controllers, stored inline.
+     */
+    using ControllerStates = inplace_vector<ButtonComboModule_ControllerState, BUTTON_COMBO_MODULE_CONTROLLER_COUNT>;
+
+    /**
+     * @brief Copies the most recent input sample of the given controllers.
+     *
+     * Wrapper for @ref ButtonComboModule_GetControllerStates.
+     * @sa ButtonComboModule_GetControllerStates
+     */
+    ButtonComboModule_Error GetControllerStates(ButtonComboModule_ControllerTypes controllerMask,
+                                                ControllerStates &outStates);
+
     /**
      * @brief Blocks execution until a combo is detected.
      *
@@ -730,5 +1939,31 @@ namespace ButtonComboModule {
      */
     ButtonComboModule_Error DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions &options,
                                                        ButtonComboModule_Buttons &outButtons);
+
+    /**
+     * @brief Registers a callback that receives all combo triggers of an input frame at once.
+     *
+     * Wrapper for @ref ButtonComboModule_SetBatchCallback.
+     * @sa ButtonComboModule_SetBatchCallback
+     */
+    ButtonComboModule_Error SetBatchCallback(ButtonComboModule_BatchCallback callback,
+                                             void *context);
+
+    /**
+     * @brief Retrieves module-wide runtime statistics. Sets `outStats.version`.
+     *
+     * Wrapper for @ref ButtonComboModule_GetStats.
+     * @sa ButtonComboModule_GetStats
+     */
+    ButtonComboModule_Error GetStats(ButtonComboModule_Stats &outStats);
+
+    /**
+     * @brief Formats statistics as human-readable text, e.g. for OSReport. Never allocates.
+     *
+     * @param stats     The statistics to format.
+     * @param outBuffer Storage for the NUL-terminated text. The text is truncated if the buffer is too small.
+     * @return The length of the full text, excluding the NUL terminator.
+     */
+    uint32_t FormatStats(const ButtonComboModule_Stats &stats, std::span<char> outBuffer);
 } // namespace ButtonComboModule
 #endif
\ No newline at end of file
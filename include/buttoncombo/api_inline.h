@@ -0,0 +1,768 @@
+/**
+ * @file api_inline.h
+ * @brief Definitions of the thin C wrappers declared in api.h.
+ *
+ * Included by api.h if `BUTTONCOMBO_INLINE` is defined, otherwise compiled into libbuttoncombo. Both modes share
+ * these definitions and behave identically. The C++ API includes them a second time into `ButtonComboModule::detail`,
+ * so there is no include guard.
+ */
+
+#include "dispatch.h"
+
+#include <stddef.h>
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_AddButtonCombo(const ButtonComboModule_ComboOptions *options,
+                                                                         ButtonComboModule_ComboHandle *outHandle,
+                                                                         ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->addButtonCombo == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || outHandle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    if (options->version != BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION &&
+        ((options->version != BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX && options->version != BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION) || table->version < 2)) {
+        return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+    }
+    if (options->version != BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION && options->triggerFilter.version != 0 &&
+        options->triggerFilter.version != BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION) {
+        return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+    }
+    // Modules before API version 2 would treat the stick directions as buttons that are never pressed.
+    if (table->version < 2 && (options->buttonComboOptions.basicCombo.combo & BUTTON_COMBO_MODULE_STICK_DIRECTION_BUTTONS) != 0) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->addButtonCombo(options, outHandle, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveButtonCombo(const ButtonComboModule_ComboHandle handle) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->removeButtonCombo == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->removeButtonCombo(handle);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveButtonCombos(const ButtonComboModule_ComboHandle *handles,
+                                                                             const uint32_t count) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->removeButtonCombos == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handles == NULL && count != 0) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (handles[i].handle == NULL) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    return table->removeButtonCombos(handles, count);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboStatus(const ButtonComboModule_ComboHandle handle,
+                                                                               ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboStatus == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outStatus == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboStatus(handle, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonComboMeta(const ButtonComboModule_ComboHandle handle,
+                                                                                const ButtonComboModule_MetaOptions *metaOptions) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateButtonComboMeta == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || metaOptions == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateButtonComboMeta(handle, metaOptions);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonComboCallback(const ButtonComboModule_ComboHandle handle,
+                                                                                    const ButtonComboModule_CallbackOptions *callbackOptions) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateButtonComboCallback == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || callbackOptions == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateButtonComboCallback(handle, callbackOptions);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateControllerMask(const ButtonComboModule_ComboHandle handle,
+                                                                               const ButtonComboModule_ControllerTypes controllerMask,
+                                                                               ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateControllerMask == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateControllerMask(handle, controllerMask, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateButtonCombo(const ButtonComboModule_ComboHandle handle,
+                                                                            const ButtonComboModule_Buttons combo,
+                                                                            ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateButtonCombo == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    if (table->version < 2 && (combo & BUTTON_COMBO_MODULE_STICK_DIRECTION_BUTTONS) != 0) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->updateButtonCombo(handle, combo, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateHoldDuration(const ButtonComboModule_ComboHandle handle,
+                                                                             const uint32_t holdDurationInMs) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateHoldDuration == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateHoldDuration(handle, holdDurationInMs);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboMeta(const ButtonComboModule_ComboHandle handle,
+                                                                             ButtonComboModule_MetaOptionsOut *outOptions) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboMeta == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outOptions == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboMeta(handle, outOptions);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboLabel(const ButtonComboModule_ComboHandle handle,
+                                                                              const char **outLabel,
+                                                                              uint32_t *outLength) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboLabel == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outLabel == NULL || outLength == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboLabel(handle, outLabel, outLength);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboLabelLength(const ButtonComboModule_ComboHandle handle,
+                                                                                    uint32_t *outLength) {
+    const char *label = NULL;
+    // Parenthesized, so the copy in ButtonComboModule::detail doesn't find the C function via argument-dependent lookup.
+    return (ButtonComboModule_GetButtonComboLabel)(handle, &label, outLength);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboCallback(const ButtonComboModule_ComboHandle handle,
+                                                                                 ButtonComboModule_CallbackOptions *outOptions) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboCallback == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outOptions == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboCallback(handle, outOptions);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboCallbackEx(const ButtonComboModule_ComboHandle handle,
+                                                                                   ButtonComboModule_ComboCallbackEx *outCallbackEx) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboCallbackEx == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outCallbackEx == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboCallbackEx(handle, outCallbackEx);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboInfoEx(const ButtonComboModule_ComboHandle handle,
+                                                                               ButtonComboModule_ButtonComboInfoEx *outOptions) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboInfoEx == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outOptions == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboInfoEx(handle, outOptions);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_CheckComboAvailable(const ButtonComboModule_ButtonComboOptions *options,
+                                                                              ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->checkComboAvailable == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || outStatus == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->checkComboAvailable(options, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboConflicts(const ButtonComboModule_ButtonComboOptions *options,
+                                                                            ButtonComboModule_ConflictInfo *outConflicts,
+                                                                            const uint32_t maxCount,
+                                                                            uint32_t *outCount) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getComboConflicts == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || (outConflicts == NULL && maxCount != 0) || outCount == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getComboConflicts(options, outConflicts, maxCount, outCount);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetButtonComboConflicts(const ButtonComboModule_ComboHandle handle,
+                                                                                  ButtonComboModule_ConflictInfo *outConflicts,
+                                                                                  const uint32_t maxCount,
+                                                                                  uint32_t *outCount) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getButtonComboConflicts == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || (outConflicts == NULL && maxCount != 0) || outCount == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getButtonComboConflicts(handle, outConflicts, maxCount, outCount);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SuggestFreeCombos(const ButtonComboModule_SuggestComboOptions *options,
+                                                                            ButtonComboModule_Buttons *outCombos,
+                                                                            const uint32_t maxCount,
+                                                                            uint32_t *outCount) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->suggestFreeCombos == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || (outCombos == NULL && maxCount != 0) || outCount == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->suggestFreeCombos(options, outCombos, maxCount, outCount);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboSnapshot(void *buffer,
+                                                                           const uint32_t bufferSize,
+                                                                           uint32_t *outRequiredSize) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getComboSnapshot == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if ((buffer == NULL && bufferSize != 0) || ((uintptr_t) buffer & 3) != 0 || outRequiredSize == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getComboSnapshot(buffer, bufferSize, outRequiredSize);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetControllerStates(const ButtonComboModule_ControllerTypes controllerMask,
+                                                                              ButtonComboModule_ControllerState *outStates,
+                                                                              const uint32_t maxCount,
+                                                                              uint32_t *outCount) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getControllerStates == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (controllerMask == 0 || (controllerMask & ~BUTTON_COMBO_MODULE_CONTROLLER_ALL) != 0 || (outStates == NULL && maxCount != 0) || outCount == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getControllerStates(controllerMask, outStates, maxCount, outCount);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_InjectInput(const ButtonComboModule_InputSample *samples,
+                                                                      const uint32_t count) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->injectInput == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (samples == NULL || count == 0) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->injectInput(samples, count);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetRealInputMask(const ButtonComboModule_ControllerTypes controllerMask) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setRealInputMask == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if ((controllerMask & ~BUTTON_COMBO_MODULE_CONTROLLER_ALL) != 0) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->setRealInputMask(controllerMask);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetRealInputMask(ButtonComboModule_ControllerTypes *outControllerMask) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getRealInputMask == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (outControllerMask == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getRealInputMask(outControllerMask);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_StartTimelineRecording(ButtonComboModule_TimelineRecorder *recorder) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->startTimelineRecording == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (recorder == NULL || recorder->events == NULL || recorder->capacity == 0) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->startTimelineRecording(recorder);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_StopTimelineRecording(void) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->stopTimelineRecording == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->stopTimelineRecording();
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions *options,
+                                                                                     ButtonComboModule_Buttons *outButtons) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->detectButtonComboBlocking == NULL || table->version < 1) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || outButtons == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->detectButtonComboBlocking(options, outButtons);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Async(const ButtonComboModule_DetectButtonComboOptions *options,
+                                                                                  const ButtonComboModule_DetectButtonComboCallback callback,
+                                                                                  void *context) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->detectButtonComboAsync == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (options == NULL || callback == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->detectButtonComboAsync(options, callback, context);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetBatchCallback(const ButtonComboModule_BatchCallback callback,
+                                                                           void *context) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setBatchCallback == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->setBatchCallback(callback, context);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateTriggerFilter(const ButtonComboModule_ComboHandle handle,
+                                                                              const uint32_t cooldownInMs,
+                                                                              const uint32_t debounceInMs) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateTriggerFilter == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateTriggerFilter(handle, cooldownInMs, debounceInMs);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetSuppressedTriggerCount(const ButtonComboModule_ComboHandle handle,
+                                                                                    uint32_t *outCount) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getSuppressedTriggerCount == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outCount == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getSuppressedTriggerCount(handle, outCount);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetTriggerFilter(const ButtonComboModule_ComboHandle handle,
+                                                                           ButtonComboModule_TriggerFilter *outFilter) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getTriggerFilter == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outFilter == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    if (outFilter->version != BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION) {
+        return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+    }
+
+    return table->getTriggerFilter(handle, outFilter);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetStats(ButtonComboModule_Stats *outStats) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getStats == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (outStats == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    if (outStats->version != BUTTON_COMBO_MODULE_STATS_VERSION) {
+        return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+    }
+
+    return table->getStats(outStats);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetCallbackBudget(const uint32_t budgetInUs) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setCallbackBudget == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->setCallbackBudget(budgetInUs);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_CreateComboGroup(ButtonComboModule_ComboGroupHandle *outGroup) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->createComboGroup == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (outGroup == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->createComboGroup(outGroup);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_DestroyComboGroup(const ButtonComboModule_ComboGroupHandle group) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->destroyComboGroup == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (group.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->destroyComboGroup(group);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_AddToComboGroup(const ButtonComboModule_ComboGroupHandle group,
+                                                                          const ButtonComboModule_ComboHandle handle) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->addToComboGroup == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (group.handle == NULL || handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->addToComboGroup(group, handle);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_RemoveFromComboGroup(const ButtonComboModule_ComboGroupHandle group,
+                                                                               const ButtonComboModule_ComboHandle handle) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->removeFromComboGroup == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (group.handle == NULL || handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->removeFromComboGroup(group, handle);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetComboGroupEnabled(const ButtonComboModule_ComboGroupHandle group,
+                                                                               const bool enabled) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setComboGroupEnabled == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (group.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->setComboGroupEnabled(group, enabled);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetClientSuspended(const bool suspended) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setClientSuspended == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    return table->setClientSuspended(suspended);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_SetButtonComboSuspendExempt(const ButtonComboModule_ComboHandle handle,
+                                                                                      const bool exempt) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->setButtonComboSuspendExempt == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->setButtonComboSuspendExempt(handle, exempt);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateComboExpression(const ButtonComboModule_ComboHandle handle,
+                                                                                const ButtonComboModule_ComboExpression *expression,
+                                                                                ButtonComboModule_ComboStatus *outStatus) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateComboExpression == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || expression == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateComboExpression(handle, expression, outStatus);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_GetComboExpression(const ButtonComboModule_ComboHandle handle,
+                                                                             ButtonComboModule_ComboExpression *outExpression) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->getComboExpression == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || outExpression == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->getComboExpression(handle, outExpression);
+}
+
+BUTTONCOMBO_API ButtonComboModule_Error ButtonComboModule_UpdateStickDirectionOptions(const ButtonComboModule_ComboHandle handle,
+                                                                                      const ButtonComboModule_StickDirectionOptions *options) {
+    const ButtonComboModule_DispatchTable *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE);
+    if (table == NULL) {
+        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+    }
+    if (table->updateStickDirectionOptions == NULL || table->version < 2) {
+        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    }
+
+    if (handle.handle == NULL || options == NULL ||
+        !(options->deadzone > 0.0f && options->deadzone <= 1.0f) ||
+        !(options->hysteresis >= 0.0f && options->hysteresis < options->deadzone)) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    return table->updateStickDirectionOptions(handle, options);
+}
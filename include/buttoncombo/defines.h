@@ -1,5 +1,6 @@
 #pragma once
 
+#include <coreinit/time.h>
 #include <stdint.h>
 #include <wut_types.h>
 
@@ -49,9 +50,30 @@ typedef enum ButtonComboModule_Buttons {
     BCMPAD_BUTTON_C = 0x100000,
     //! The Z button on the nunchuck (exclusive to Wiimotes)
     BCMPAD_BUTTON_Z = 0x200000,
+    //! The left stick has been pushed left (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_L_LEFT = 0x40000000,
+    //! The left stick has been pushed right (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_L_RIGHT = 0x20000000,
+    //! The left stick has been pushed up (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_L_UP = 0x10000000,
+    //! The left stick has been pushed down (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_L_DOWN = 0x08000000,
+    //! The right stick has been pushed left (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_R_LEFT = 0x04000000,
+    //! The right stick has been pushed right (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_R_RIGHT = 0x02000000,
+    //! The right stick has been pushed up (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_R_UP = 0x01000000,
+    //! The right stick has been pushed down (virtual, requires ButtonComboModule API version 2 or higher)
+    BCMPAD_BUTTON_STICK_R_DOWN = 0x00800000,
 } ButtonComboModule_Buttons;
 WUT_ENUM_BITMASK_TYPE(ButtonComboModule_Buttons);
 
+//! All physical buttons of all controllers, i.e. everything except the reserved bit and the virtual stick directions.
+#define BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS        ((ButtonComboModule_Buttons) 0x0037FFFF)
+//! All virtual stick direction buttons, e.g. @ref BCMPAD_BUTTON_STICK_L_LEFT.
+#define BUTTON_COMBO_MODULE_STICK_DIRECTION_BUTTONS ((ButtonComboModule_Buttons) 0x7F800000)
+
 typedef enum ButtonComboModule_Error {
     BUTTON_COMBO_MODULE_ERROR_SUCCESS                      = 0,
     BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT             = -1,
@@ -66,6 +88,7 @@ typedef enum ButtonComboModule_Error {
     BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND          = -10,
     BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED            = -11,
     BUTTON_COMBO_MODULE_ERROR_ABORTED                      = -12,
+    BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL             = -13,
     BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR                = -0xFF,
 } ButtonComboModule_Error;
 
@@ -108,6 +131,22 @@ typedef struct ButtonComboModule_ComboHandle {
 #endif
 } ButtonComboModule_ComboHandle;
 
+typedef struct ButtonComboModule_ComboGroupHandle {
+    void *handle;
+#ifdef __cplusplus
+    ButtonComboModule_ComboGroupHandle() {
+        handle = nullptr;
+    }
+    explicit ButtonComboModule_ComboGroupHandle(void *handle) : handle(handle) {}
+    bool operator==(const ButtonComboModule_ComboGroupHandle other) const {
+        return handle == other.handle;
+    }
+    bool operator==(const void *other) const {
+        return handle == other;
+    }
+#endif
+} ButtonComboModule_ComboGroupHandle;
+
 typedef int32_t ButtonComboModule_APIVersion;
 
 typedef enum ButtonComboModule_ComboType {
@@ -122,6 +161,7 @@ typedef enum ButtonComboModule_ComboStatus {
     BUTTON_COMBO_MODULE_COMBO_STATUS_INVALID_STATUS = 0, // Invalid status, this only happens on errors.
     BUTTON_COMBO_MODULE_COMBO_STATUS_VALID          = 1, // The Combo is valid and active
     BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT       = 2, // The Combo is already used by a different combo. Update to combo by updating the combo or controller mask.
+    BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED       = 3, // The Combo is part of a disabled combo group. It's not checked and doesn't cause conflicts.
 } ButtonComboModule_ComboStatus;
 
 typedef struct ButtonComboModule_DetectButtonComboOptions {
@@ -151,8 +191,78 @@ typedef struct ButtonComboModule_DetectButtonComboOptions {
  */
 typedef void (*ButtonComboModule_ComboCallback)(ButtonComboModule_ControllerTypes triggeredBy, ButtonComboModule_ComboHandle handle, void *context);
 
-#define BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION 1
-#define BUTTON_COMBO_MODULE_API_VERSION_ERROR     (-0xFF)
+/**
+ * @typedef ButtonComboModule_DetectButtonComboCallback
+ * @brief Callback function type for the result of an asynchronous button combo detection.
+ *
+ * @param result
+ *        BUTTON_COMBO_MODULE_ERROR_SUCCESS if a combo was detected, BUTTON_COMBO_MODULE_ERROR_ABORTED if the abort
+ *        combo was pressed.
+ *
+ * @param buttons
+ *        The detected button combo. Only valid if result is BUTTON_COMBO_MODULE_ERROR_SUCCESS.
+ *
+ * @param context
+ *        The user-defined context pointer passed to @ref ButtonComboModule_DetectButtonCombo_Async.
+ */
+typedef void (*ButtonComboModule_DetectButtonComboCallback)(ButtonComboModule_Error result, ButtonComboModule_Buttons buttons, void *context);
+
+/**
+ * @brief Details about a single trigger of a button combo. Passed to a @ref ButtonComboModule_ComboCallbackEx.
+ */
+typedef struct ButtonComboModule_TriggerInfo {
+    ButtonComboModule_ControllerTypes triggeredBy; // The controller that triggered the combo
+    ButtonComboModule_Buttons buttons;             // All buttons that were held on the triggering controller, may contain more than the combo
+    OSTime inputTime;                              // Time at which the input sample that triggered the combo has been read
+    OSTime dispatchTime;                           // Time at which the callback has been dispatched
+    uint32_t heldForInMs;                          // How long the combo has actually been held. 0 for press down combos
+} ButtonComboModule_TriggerInfo;
+
+/**
+ * @typedef ButtonComboModule_ComboCallbackEx
+ * @brief Extended callback function type for handling button combo events.
+ *
+ * Used instead of @ref ButtonComboModule_ComboCallback if the combo has been added with
+ * @ref BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX or @ref BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION.
+ *
+ * @param info
+ *        Details about the trigger. Only valid for the duration of the callback.
+ *
+ * @param handle
+ *        A handle representing the button combo that was triggered.
+ *
+ * @param context
+ *        The user-defined context pointer of the combo (`callbackOptions.context`).
+ */
+typedef void (*ButtonComboModule_ComboCallbackEx)(const ButtonComboModule_TriggerInfo *info, ButtonComboModule_ComboHandle handle, void *context);
+
+#define BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION            1
+#define BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX         2 // Requires ButtonComboModule API version 2 or higher
+#define BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION 3 // Requires ButtonComboModule API version 2 or higher
+#define BUTTON_COMBO_MODULE_API_VERSION_ERROR                (-0xFF)
+
+#define BUTTON_COMBO_MODULE_EXPRESSION_MAX_ANY_OF 4
+
+/**
+ * @brief A combo expressed as required, any-of and forbidden buttons.
+ *
+ * The combo is down if all `required` buttons, at least one button of each non-empty `anyOf` mask and none of the
+ * `forbidden` buttons are held. The module evaluates this without branches:
+ * `(held & required) == required && (held & anyOf[i]) != 0 (for each non-empty anyOf[i]) && (held & forbidden) == 0`.
+ *
+ * The virtual stick direction buttons are part of `held` as well. A `forbidden` mask built as `~(L | R)` would also
+ * forbid them, so such a combo never triggers while a stick is tilted. Mask with
+ * @ref BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS to only forbid the other physical buttons.
+ *
+ * Examples:
+ * - "A or B while ZR is not held": `anyOf[0] = A | B`, `forbidden = ZR`
+ * - "exactly L+R and no other button": `required = L | R`, `forbidden = BUTTON_COMBO_MODULE_PHYSICAL_BUTTONS & ~(L | R)`
+ */
+typedef struct ButtonComboModule_ComboExpression {
+    ButtonComboModule_Buttons required;                                         // Buttons that all have to be held. May be empty if at least one anyOf mask is not empty
+    ButtonComboModule_Buttons anyOf[BUTTON_COMBO_MODULE_EXPRESSION_MAX_ANY_OF]; // At least one button of each non-empty mask has to be held
+    ButtonComboModule_Buttons forbidden;                                        // None of these buttons may be held. Must not overlap with required
+} ButtonComboModule_ComboExpression;
 
 typedef struct ButtonComboModule_MetaOptions {
     const char *label; // Label that identifies a button combo, currently only used for debugging
@@ -173,15 +283,298 @@ typedef struct ButtonComboModule_ButtonComboOptions {
     ButtonComboModule_Buttons combo;                  // Defines which combo should be detected.Note : Not all button are available on all controllers.Must not be empty.
 } ButtonComboModule_ButtonComboOptions;
 
+typedef struct ButtonComboModule_SuggestComboOptions {
+    ButtonComboModule_ControllerTypes controllerMask; // The suggested combos have to be free on all of these controllers. Must not be empty.
+    ButtonComboModule_Buttons allowedButtons;         // Only these buttons are used for suggestions. Must not be empty.
+    uint32_t maxChordSize;                            // Maximum number of buttons per suggested combo. Must not be 0.
+} ButtonComboModule_SuggestComboOptions;
+
 typedef struct ButtonComboModule_ButtonComboInfoEx {
     ButtonComboModule_ComboType type;                // Defines the type of the combo AND if it will check for conflicts.
     ButtonComboModule_ButtonComboOptions basicCombo; // Defines which combo should be checked on which controller
     uint32_t optionalHoldForXMs;                     // Only mandatory if the type is set to COMBO_TYPE_HOLD or COMBO_TYPE_HOLD_OBSERVER
 } ButtonComboModule_ButtonComboInfoEx;
 
+#define BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION 1
+
+/**
+ * @brief Cooldown and debounce time of a combo. Triggers that are filtered out are suppressed before dispatch and are
+ * counted, see @ref ButtonComboModule_GetSuppressedTriggerCount.
+ */
+typedef struct ButtonComboModule_TriggerFilter {
+    uint32_t version;      // Set to BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION. 0 inside ButtonComboModule_ComboOptions disables the filter
+    uint32_t cooldownInMs; // Minimum time between two triggers. Triggers within the cooldown are suppressed. 0 disables the cooldown
+    uint32_t debounceInMs; // How long the combo has to be released before it may trigger again. Shorter releases are ignored. 0 disables debouncing
+} ButtonComboModule_TriggerFilter;
+
 typedef struct ButtonComboModule_ComboOptions {
-    int version;                                            // Has to be set to BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION
+    int version;                                            // Has to be set to BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION, BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX or BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION
     ButtonComboModule_MetaOptions metaOptions;              // Defines the meta information about the combo e.g. the label
-    ButtonComboModule_CallbackOptions callbackOptions;      // Defines the callback that should be called once the combo is detected
+    ButtonComboModule_CallbackOptions callbackOptions;      // Defines the callback that should be called once the combo is detected. The callback can be NULL if callbackEx is used
     ButtonComboModule_ButtonComboInfoEx buttonComboOptions; // Defines how and when which combo should be detected
-} ButtonComboModule_ComboOptions;
\ No newline at end of file
+    // Only read if version is BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX or BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION
+    ButtonComboModule_ComboCallbackEx callbackEx;  // If not NULL, it's called instead of callbackOptions.callback, with callbackOptions.context as context
+    ButtonComboModule_TriggerFilter triggerFilter; // Cooldown and debounce time, ignored if triggerFilter.version is 0
+    // Only read if version is BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION
+    ButtonComboModule_ComboExpression expression; // Replaces buttonComboOptions.basicCombo.combo
+} ButtonComboModule_ComboOptions;
+
+/**
+ * @brief A single combo trigger, delivered to a @ref ButtonComboModule_BatchCallback.
+ */
+typedef struct ButtonComboModule_TriggerRecord {
+    ButtonComboModule_ComboHandle handle;              // The combo that has been triggered
+    ButtonComboModule_ControllerTypes triggeredBy;     // The controller that triggered the combo
+    ButtonComboModule_CallbackOptions callbackOptions; // The callback and context registered for the combo
+} ButtonComboModule_TriggerRecord;
+
+/**
+ * @typedef ButtonComboModule_BatchCallback
+ * @brief Callback function type for receiving all combo triggers of an input frame at once.
+ *
+ * @param records
+ *        Array of all triggers of the current input frame. Only valid for the duration of the callback.
+ *
+ * @param count
+ *        Number of records in the array. Never 0.
+ *
+ * @param context
+ *        The user-defined context pointer passed to @ref ButtonComboModule_SetBatchCallback.
+ */
+typedef void (*ButtonComboModule_BatchCallback)(const ButtonComboModule_TriggerRecord *records, uint32_t count, void *context);
+
+/**
+ * @typedef ButtonComboModule_ExecutorPostFn
+ * @brief Hands a combo trigger off to an executor.
+ *
+ * Called from the module's input thread, must not block. The executor is expected to call
+ * `record->callbackOptions.callback` later on a thread of its choice.
+ *
+ * @param userData
+ *        The `userData` of the @ref ButtonComboModule_Executor.
+ *
+ * @param record
+ *        The trigger to execute. Only valid for the duration of the call, it has to be copied.
+ *
+ * @return true if the trigger has been queued, false if it has been rejected (e.g. because the queue is full).
+ */
+typedef bool (*ButtonComboModule_ExecutorPostFn)(void *userData, const ButtonComboModule_TriggerRecord *record);
+
+/**
+ * @brief An executor that runs combo callbacks on a thread of its choice, see @ref ButtonComboModule_BindExecutor.
+ */
+typedef struct ButtonComboModule_Executor {
+    ButtonComboModule_ExecutorPostFn post; // Must not be NULL.
+    void *userData;                        // Passed into post. Can be NULL
+} ButtonComboModule_Executor;
+
+/**
+ * @brief Storage for binding a combo to an executor. Owned by the caller and must stay valid until the combo has been
+ * unbound or removed. Don't modify the fields while the binding is active.
+ */
+typedef struct ButtonComboModule_ExecutorBinding {
+    ButtonComboModule_ComboHandle handle;              // The bound combo
+    ButtonComboModule_Executor executor;               // The executor the triggers are handed off to
+    ButtonComboModule_CallbackOptions callbackOptions; // The original callback of the combo
+    uint32_t droppedCount;                             // Number of triggers the executor has rejected
+    uint32_t inFlight;                                 // Number of triggers that are currently being posted
+} ButtonComboModule_ExecutorBinding;
+
+/**
+ * @brief Storage for swapping the callback of a combo without blocking the module's input thread, see
+ * @ref ButtonComboModule_InstallCallbackSlot. Owned by the caller, don't access the fields directly.
+ */
+typedef struct ButtonComboModule_CallbackSlot {
+    ButtonComboModule_ComboHandle handle;                 // The combo the slot is installed for
+    ButtonComboModule_CallbackOptions callbackOptions[2]; // The published pair and the pair of the next swap
+    uint32_t active;                                      // Index of the published pair
+    uint32_t readers[2];                                  // Number of in-flight dispatches per pair
+    uint32_t writerLock;                                  // Serializes swaps
+} ButtonComboModule_CallbackSlot;
+
+#define BUTTON_COMBO_MODULE_SNAPSHOT_VERSION 1
+
+/**
+ * @brief Header of a combo snapshot, see @ref ButtonComboModule_GetComboSnapshot.
+ *
+ * The header is followed by `entryCount` entries of `entrySize` bytes each, starting at `headerSize`. All offsets
+ * are relative to the start of the buffer.
+ */
+typedef struct ButtonComboModule_SnapshotHeader {
+    uint32_t version;          // Set to BUTTON_COMBO_MODULE_SNAPSHOT_VERSION
+    uint32_t headerSize;       // Offset of the first entry
+    uint32_t entrySize;        // Size of a single entry. Newer modules may append fields, always use this as stride
+    uint32_t entryCount;       // Number of entries
+    uint32_t stringPoolOffset; // Offset of the string pool
+    uint32_t stringPoolSize;   // Size of the string pool in bytes
+} ButtonComboModule_SnapshotHeader;
+
+/**
+ * @brief A single registered combo inside a combo snapshot.
+ */
+typedef struct ButtonComboModule_SnapshotEntry {
+    ButtonComboModule_ComboHandle handle;             // Only meaningful while the combo is registered, may belong to a different client
+    uint32_t ownerOffset;                             // Offset of the NUL-terminated name of the module/plugin that added the combo, relative to the string pool
+    ButtonComboModule_ComboType type;                 // Type of the combo
+    ButtonComboModule_ControllerTypes controllerMask; // Controllers the combo is checked on
+    ButtonComboModule_Buttons combo;                  // Buttons of the combo
+    uint32_t holdDurationInMs;                        // 0 for press down combos
+    ButtonComboModule_ComboStatus status;             // Current status of the combo
+    uint32_t labelOffset;                             // Offset of the NUL-terminated label, relative to the string pool
+} ButtonComboModule_SnapshotEntry;
+
+#define BUTTON_COMBO_MODULE_STATS_VERSION    1
+#define BUTTON_COMBO_MODULE_COMBO_TYPE_COUNT 5
+#define BUTTON_COMBO_MODULE_CONTROLLER_COUNT 9
+
+/**
+ * @brief Module-wide runtime statistics, see @ref ButtonComboModule_GetStats.
+ *
+ * Covers the combos of all clients, not only the ones added by the caller.
+ */
+typedef struct ButtonComboModule_Stats {
+    uint32_t version;                                                  // Has to be set to BUTTON_COMBO_MODULE_STATS_VERSION
+    uint32_t combosByType[BUTTON_COMBO_MODULE_COMBO_TYPE_COUNT];       // Registered combos, indexed by ButtonComboModule_ComboType
+    uint32_t combosByController[BUTTON_COMBO_MODULE_CONTROLLER_COUNT]; // Registered combos per controller, indexed by the bit of the controller in ButtonComboModule_ControllerTypes
+    uint32_t comboMemoryInBytes;                                       // Module memory used for the combos, excluding labels
+    uint32_t labelMemoryInBytes;                                       // Module memory used for the labels
+    uint32_t avgFrameEvalTimeInUs;                                     // Average time to evaluate all combos of an input frame, since the module has been loaded
+    uint32_t peakFrameEvalTimeInUs;                                    // Longest time to evaluate all combos of an input frame, since the module has been loaded
+    uint64_t callbacksDispatched;                                      // Number of combo callbacks the module has called
+    uint64_t callbacksOverBudget;                                      // Number of combo callbacks that took longer than callbackBudgetInUs
+    uint32_t callbackBudgetInUs;                                       // The current callback budget, see ButtonComboModule_SetCallbackBudget. 0 if disabled
+} ButtonComboModule_Stats;
+
+#define BUTTON_COMBO_MODULE_CONFLICT_LABEL_LENGTH 64
+
+typedef enum ButtonComboModule_ConflictKind {
+    BUTTON_COMBO_MODULE_CONFLICT_KIND_IDENTICAL = 0, // Both combos use the same buttons
+    BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET    = 1, // The registered combo is a subset of the checked combo, e.g. "L+R" when checking "X+L+R"
+    BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET  = 2, // The registered combo is a superset of the checked combo, e.g. "X+L+R" when checking "L+R"
+    BUTTON_COMBO_MODULE_CONFLICT_KIND_OVERLAP   = 3, // Only used for expression combos: some, but not all states that trigger one combo trigger the other
+} ButtonComboModule_ConflictKind;
+
+/**
+ * @brief A registered combo that conflicts with a checked combo, see @ref ButtonComboModule_GetComboConflicts.
+ */
+typedef struct ButtonComboModule_ConflictInfo {
+    ButtonComboModule_ComboHandle handle;                  // Only meaningful while the combo is registered, may belong to a different client
+    ButtonComboModule_ComboType type;                      // Type of the registered combo
+    ButtonComboModule_ControllerTypes controllerMask;      // Controllers of the registered combo. Only the controllers shared with the checked combo conflict
+    ButtonComboModule_Buttons combo;                       // Buttons of the registered combo. For expression combos the required buttons
+    ButtonComboModule_ConflictKind kind;                   // How the buttons of the registered combo relate to the checked combo
+    char label[BUTTON_COMBO_MODULE_CONFLICT_LABEL_LENGTH]; // NUL-terminated label of the registered combo, truncated if necessary
+} ButtonComboModule_ConflictInfo;
+
+#define BUTTON_COMBO_MODULE_STICK_DEADZONE_DEFAULT   0.5f
+#define BUTTON_COMBO_MODULE_STICK_HYSTERESIS_DEFAULT 0.1f
+
+/**
+ * @brief Thresholds of the virtual stick direction buttons (e.g. @ref BCMPAD_BUTTON_STICK_R_UP) of a combo.
+ *
+ * Each axis is checked on its own, stick values range from -1.0 to 1.0. A direction is pressed once the stick is pushed
+ * at least `deadzone` in that direction. It's released once the stick is back below `deadzone - hysteresis`, so a stick
+ * resting on the threshold doesn't toggle the direction every frame.
+ */
+typedef struct ButtonComboModule_StickDirectionOptions {
+    float deadzone;   // 0.0 < deadzone <= 1.0. Defaults to BUTTON_COMBO_MODULE_STICK_DEADZONE_DEFAULT
+    float hysteresis; // 0.0 <= hysteresis < deadzone. Defaults to BUTTON_COMBO_MODULE_STICK_HYSTERESIS_DEFAULT
+} ButtonComboModule_StickDirectionOptions;
+
+/**
+ * @brief The most recent input sample of a single controller, see @ref ButtonComboModule_GetControllerStates.
+ */
+typedef struct ButtonComboModule_ControllerState {
+    ButtonComboModule_ControllerTypes controller; // Exactly one controller
+    ButtonComboModule_Buttons buttons;            // Held buttons, including the stick directions with the default thresholds
+    OSTime sampleTime;                            // Time the sample has been read. 0 if the module hasn't seen a sample of this controller yet
+    bool connected;                               // false if the controller is disconnected. buttons is 0 in that case
+} ButtonComboModule_ControllerState;
+
+/**
+ * @brief A synthetic input sample of a single controller, see @ref ButtonComboModule_InjectInput.
+ */
+typedef struct ButtonComboModule_InputSample {
+    ButtonComboModule_ControllerTypes controller; // Exactly one controller
+    ButtonComboModule_Buttons buttons;            // All buttons that are held, may include the stick directions
+    OSTime sampleTime;                            // Time of the sample, used for the hold durations. Must not go backwards per controller
+} ButtonComboModule_InputSample;
+
+/**
+ * @brief State of a combo on a single controller, as recorded by @ref ButtonComboModule_StartTimelineRecording.
+ */
+typedef enum ButtonComboModule_TimelineState {
+    BUTTON_COMBO_MODULE_TIMELINE_STATE_IDLE       = 0, // The combo is not pressed
+    BUTTON_COMBO_MODULE_TIMELINE_STATE_ARMING     = 1, // Pressed, waiting for the hold duration (hold combos only)
+    BUTTON_COMBO_MODULE_TIMELINE_STATE_FIRED      = 2, // The callback has been dispatched
+    BUTTON_COMBO_MODULE_TIMELINE_STATE_SUPPRESSED = 3, // Would have fired, but was swallowed by a conflict or the trigger filter
+    BUTTON_COMBO_MODULE_TIMELINE_STATE_HELD       = 4, // Still pressed after it has fired or has been suppressed
+} ButtonComboModule_TimelineState;
+
+/**
+ * @brief A single state transition inside a @ref ButtonComboModule_TimelineRecorder.
+ */
+typedef struct ButtonComboModule_TimelineEvent {
+    OSTime sampleTime;                             // Time of the input sample that caused the transition
+    ButtonComboModule_ComboHandle handle;          // The combo, may belong to a different client
+    ButtonComboModule_ControllerTypes controller;  // Exactly one controller
+    ButtonComboModule_TimelineState previousState; // State before the transition
+    ButtonComboModule_TimelineState state;         // State after the transition
+    uint32_t heldForInMs;                          // How long the combo has been pressed at the time of the transition
+} ButtonComboModule_TimelineEvent;
+
+/**
+ * @brief Fixed-size ring buffer the module records combo state transitions into.
+ *
+ * Owned by the caller. The latest event is at `events[(totalCount - 1) % capacity]`, older events are overwritten
+ * once the buffer is full.
+ */
+typedef struct ButtonComboModule_TimelineRecorder {
+    ButtonComboModule_TimelineEvent *events; // Storage for `capacity` events
+    uint32_t capacity;                       // Number of events that fit into `events`
+    uint32_t totalCount;                     // Number of events recorded since the start. Written by the module
+    uint32_t recording;                      // Non-zero while the module records into `events`. Written by the module
+} ButtonComboModule_TimelineRecorder;
+
+#define BUTTON_COMBO_MODULE_TIMELINE_DUMP_MAGIC   0x42435444 // "BCTD", read back byte-swapped on little-endian hosts
+#define BUTTON_COMBO_MODULE_TIMELINE_DUMP_VERSION 1
+#define BUTTON_COMBO_MODULE_TIMELINE_LABEL_LENGTH 64
+
+/**
+ * @brief Header of a timeline dump, see @ref ButtonComboModule_WriteTimelineDump.
+ *
+ * The header is followed by `eventCount` events and `comboCount` combos. All offsets are relative to the start of
+ * the dump. A dump contains no pointers, all fields are written in the byte order of the console.
+ */
+typedef struct ButtonComboModule_TimelineDumpHeader {
+    uint32_t magic;          // Set to BUTTON_COMBO_MODULE_TIMELINE_DUMP_MAGIC
+    uint32_t version;        // Set to BUTTON_COMBO_MODULE_TIMELINE_DUMP_VERSION
+    uint32_t headerSize;     // Offset of the first event
+    uint32_t eventSize;      // Size of a single event, always use this as stride
+    uint32_t eventCount;     // Number of events, oldest first
+    uint32_t droppedCount;   // Number of events that have been overwritten before the dump was written
+    uint32_t comboOffset;    // Offset of the first combo
+    uint32_t comboSize;      // Size of a single combo, always use this as stride
+    uint32_t comboCount;     // Number of combos
+    uint32_t ticksPerSecond; // Converts the sample times to seconds
+} ButtonComboModule_TimelineDumpHeader;
+
+/**
+ * @brief A single state transition inside a timeline dump.
+ */
+typedef struct ButtonComboModule_TimelineDumpEvent {
+    int64_t sampleTime;     // Time of the input sample in ticks
+    uint32_t comboIndex;    // Index of the combo inside the dump
+    uint32_t controller;    // ButtonComboModule_ControllerTypes, exactly one controller
+    uint32_t previousState; // ButtonComboModule_TimelineState
+    uint32_t state;         // ButtonComboModule_TimelineState
+    uint32_t heldForInMs;   // How long the combo has been pressed at the time of the transition
+    uint32_t reserved;
+} ButtonComboModule_TimelineDumpEvent;
+
+/**
+ * @brief A combo that is referenced by the events of a timeline dump.
+ */
+typedef struct ButtonComboModule_TimelineDumpCombo {
+    char label[BUTTON_COMBO_MODULE_TIMELINE_LABEL_LENGTH]; // NUL-terminated, truncated if needed. Empty if the label couldn't be read
+} ButtonComboModule_TimelineDumpCombo;
\ No newline at end of file
@@ -0,0 +1,87 @@
+/**
+ * @file dispatch.h
+ * @brief Internal dispatch state shared between libbuttoncombo and the inline API.
+ *
+ * Do not use anything in here directly, it may change at any time. Use the functions in api.h instead.
+ */
+
+#pragma once
+
+#include "defines.h"
+
+/**
+ * Defining `BUTTONCOMBO_INLINE` before including api.h turns the thin C wrappers into `static inline` functions that
+ * call into the module directly. All other functions (e.g. @ref ButtonComboModule_InitLibrary) are still provided by
+ * libbuttoncombo. It's recommended to define it consistently for all translation units of a project.
+ */
+#ifdef BUTTONCOMBO_INLINE
+#define BUTTONCOMBO_API static inline
+#else
+#define BUTTONCOMBO_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ButtonComboModule_DispatchTable {
+    ButtonComboModule_APIVersion version;
+
+    ButtonComboModule_Error (*getVersion)(ButtonComboModule_APIVersion *outVersion);
+    ButtonComboModule_Error (*addButtonCombo)(const ButtonComboModule_ComboOptions *options, ButtonComboModule_ComboHandle *outHandle, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*removeButtonCombo)(ButtonComboModule_ComboHandle handle);
+    ButtonComboModule_Error (*getButtonComboStatus)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*updateButtonComboMeta)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_MetaOptions *options);
+    ButtonComboModule_Error (*updateButtonComboCallback)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_CallbackOptions *options);
+    ButtonComboModule_Error (*updateControllerMask)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ControllerTypes controllerMask, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*updateButtonCombo)(ButtonComboModule_ComboHandle handle, ButtonComboModule_Buttons combo, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*updateHoldDuration)(ButtonComboModule_ComboHandle handle, uint32_t holdDurationInMs);
+    ButtonComboModule_Error (*getButtonComboMeta)(ButtonComboModule_ComboHandle handle, ButtonComboModule_MetaOptionsOut *outOptions);
+    ButtonComboModule_Error (*getButtonComboCallback)(ButtonComboModule_ComboHandle handle, ButtonComboModule_CallbackOptions *outOptions);
+    ButtonComboModule_Error (*getButtonComboInfoEx)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ButtonComboInfoEx *outOptions);
+
+    ButtonComboModule_Error (*checkComboAvailable)(const ButtonComboModule_ButtonComboOptions *options, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*detectButtonComboBlocking)(const ButtonComboModule_DetectButtonComboOptions *options, ButtonComboModule_Buttons *outButtonCombo);
+
+    // Optional, requires API version 2
+    ButtonComboModule_Error (*detectButtonComboAsync)(const ButtonComboModule_DetectButtonComboOptions *options, ButtonComboModule_DetectButtonComboCallback callback, void *context);
+    ButtonComboModule_Error (*removeButtonCombos)(const ButtonComboModule_ComboHandle *handles, uint32_t count);
+    ButtonComboModule_Error (*setBatchCallback)(ButtonComboModule_BatchCallback callback, void *context);
+    ButtonComboModule_Error (*updateTriggerFilter)(ButtonComboModule_ComboHandle handle, uint32_t cooldownInMs, uint32_t debounceInMs);
+    ButtonComboModule_Error (*getSuppressedTriggerCount)(ButtonComboModule_ComboHandle handle, uint32_t *outCount);
+    ButtonComboModule_Error (*suggestFreeCombos)(const ButtonComboModule_SuggestComboOptions *options, ButtonComboModule_Buttons *outCombos, uint32_t maxCount, uint32_t *outCount);
+    ButtonComboModule_Error (*getComboSnapshot)(void *buffer, uint32_t bufferSize, uint32_t *outRequiredSize);
+    ButtonComboModule_Error (*getStats)(ButtonComboModule_Stats *outStats);
+    ButtonComboModule_Error (*setCallbackBudget)(uint32_t budgetInUs);
+    ButtonComboModule_Error (*createComboGroup)(ButtonComboModule_ComboGroupHandle *outGroup);
+    ButtonComboModule_Error (*destroyComboGroup)(ButtonComboModule_ComboGroupHandle group);
+    ButtonComboModule_Error (*addToComboGroup)(ButtonComboModule_ComboGroupHandle group, ButtonComboModule_ComboHandle handle);
+    ButtonComboModule_Error (*removeFromComboGroup)(ButtonComboModule_ComboGroupHandle group, ButtonComboModule_ComboHandle handle);
+    ButtonComboModule_Error (*setComboGroupEnabled)(ButtonComboModule_ComboGroupHandle group, bool enabled);
+    ButtonComboModule_Error (*updateComboExpression)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_ComboExpression *expression, ButtonComboModule_ComboStatus *outStatus);
+    ButtonComboModule_Error (*getComboExpression)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboExpression *outExpression);
+    ButtonComboModule_Error (*getComboConflicts)(const ButtonComboModule_ButtonComboOptions *options, ButtonComboModule_ConflictInfo *outConflicts, uint32_t maxCount, uint32_t *outCount);
+    ButtonComboModule_Error (*getButtonComboConflicts)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ConflictInfo *outConflicts, uint32_t maxCount, uint32_t *outCount);
+    ButtonComboModule_Error (*getButtonComboLabel)(ButtonComboModule_ComboHandle handle, const char **outLabel, uint32_t *outLength);
+    ButtonComboModule_Error (*updateStickDirectionOptions)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_StickDirectionOptions *options);
+    ButtonComboModule_Error (*getControllerStates)(ButtonComboModule_ControllerTypes controllerMask, ButtonComboModule_ControllerState *outStates, uint32_t maxCount, uint32_t *outCount);
+    ButtonComboModule_Error (*injectInput)(const ButtonComboModule_InputSample *samples, uint32_t count);
+    ButtonComboModule_Error (*setRealInputMask)(ButtonComboModule_ControllerTypes controllerMask);
+    ButtonComboModule_Error (*startTimelineRecording)(ButtonComboModule_TimelineRecorder *recorder);
+    ButtonComboModule_Error (*stopTimelineRecording)(void);
+    ButtonComboModule_Error (*getButtonComboCallbackEx)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboCallbackEx *outCallbackEx);
+    ButtonComboModule_Error (*setClientSuspended)(bool suspended);
+    ButtonComboModule_Error (*setButtonComboSuspendExempt)(ButtonComboModule_ComboHandle handle, bool exempt);
+    ButtonComboModule_Error (*getRealInputMask)(ButtonComboModule_ControllerTypes *outControllerMask);
+    ButtonComboModule_Error (*getTriggerFilter)(ButtonComboModule_ComboHandle handle, ButtonComboModule_TriggerFilter *outFilter);
+} ButtonComboModule_DispatchTable;
+
+/**
+ * @brief Resolved module exports. Published by @ref ButtonComboModule_InitLibrary, `NULL` while the library is not
+ * initialized. Must be loaded with acquire semantics.
+ */
+extern const ButtonComboModule_DispatchTable *gButtonComboModuleDispatch;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,129 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief Minimal replacement for `std::unexpected`, see @ref expected.
+     */
+    template<typename E>
+    class unexpected {
+    public:
+        constexpr explicit unexpected(E error) : mError(std::move(error)) {}
+
+        [[nodiscard]] constexpr const E &error() const & noexcept { return mError; }
+        [[nodiscard]] constexpr E &error() & noexcept { return mError; }
+
+    private:
+        E mError;
+    };
+
+    /**
+     * @brief Minimal replacement for `std::expected`.
+     *
+     * Used even if the toolchain provides `<expected>`: the library is built with C++20, so its functions must return
+     * the same type to callers that are compiled with C++23.
+     *
+     * Only provides the non-throwing subset of `std::expected`, `value()` is intentionally missing.
+     * Accessing the value of an expected that holds an error (or vice versa) is undefined behaviour.
+     */
+    template<typename T, typename E>
+    class expected {
+    public:
+        using value_type      = T;
+        using error_type      = E;
+        using unexpected_type = unexpected<E>;
+
+        constexpr expected(const T &value) requires(std::is_copy_constructible_v<T>) : mHasValue(true) {
+            std::construct_at(std::addressof(mValue), value);
+        }
+
+        constexpr expected(T &&value) : mHasValue(true) {
+            std::construct_at(std::addressof(mValue), std::move(value));
+        }
+
+        constexpr expected(const unexpected<E> &error) : mHasValue(false) {
+            std::construct_at(std::addressof(mError), error.error());
+        }
+
+        constexpr expected(const expected &src) requires(std::is_copy_constructible_v<T>) : mHasValue(src.mHasValue) {
+            if (mHasValue) {
+                std::construct_at(std::addressof(mValue), src.mValue);
+            } else {
+                std::construct_at(std::addressof(mError), src.mError);
+            }
+        }
+
+        constexpr expected(expected &&src) noexcept(std::is_nothrow_move_constructible_v<T>) : mHasValue(src.mHasValue) {
+            if (mHasValue) {
+                std::construct_at(std::addressof(mValue), std::move(src.mValue));
+            } else {
+                std::construct_at(std::addressof(mError), std::move(src.mError));
+            }
+        }
+
+        constexpr expected &operator=(const expected &src) requires(std::is_copy_constructible_v<T>) {
+            if (this != &src) {
+                Destroy();
+                mHasValue = src.mHasValue;
+                if (mHasValue) {
+                    std::construct_at(std::addressof(mValue), src.mValue);
+                } else {
+                    std::construct_at(std::addressof(mError), src.mError);
+                }
+            }
+            return *this;
+        }
+
+        constexpr expected &operator=(expected &&src) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            if (this != &src) {
+                Destroy();
+                mHasValue = src.mHasValue;
+                if (mHasValue) {
+                    std::construct_at(std::addressof(mValue), std::move(src.mValue));
+                } else {
+                    std::construct_at(std::addressof(mError), std::move(src.mError));
+                }
+            }
+            return *this;
+        }
+
+        constexpr ~expected() {
+            Destroy();
+        }
+
+        [[nodiscard]] constexpr bool has_value() const noexcept { return mHasValue; }
+        constexpr explicit operator bool() const noexcept { return mHasValue; }
+
+        constexpr T &operator*() & noexcept { return mValue; }
+        constexpr const T &operator*() const & noexcept { return mValue; }
+        constexpr T &&operator*() && noexcept { return std::move(mValue); }
+
+        constexpr T *operator->() noexcept { return std::addressof(mValue); }
+        constexpr const T *operator->() const noexcept { return std::addressof(mValue); }
+
+        [[nodiscard]] constexpr const E &error() const & noexcept { return mError; }
+
+    private:
+        constexpr void Destroy() {
+            if (mHasValue) {
+                std::destroy_at(std::addressof(mValue));
+            } else {
+                std::destroy_at(std::addressof(mError));
+            }
+        }
+
+        union {
+            T mValue;
+            E mError;
+        };
+        bool mHasValue;
+    };
+} // namespace ButtonComboModule
+
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifdef __cplusplus
+
+#if __has_include(<inplace_vector>)
+#include <inplace_vector>
+#endif
+
+#include <cstddef>
+
+#if defined(__cpp_lib_inplace_vector) && __cpp_lib_inplace_vector >= 202406L
+
+namespace ButtonComboModule {
+    template<typename T, size_t N>
+    using inplace_vector = std::inplace_vector<T, N>;
+} // namespace ButtonComboModule
+
+#else
+
+#include <memory>
+#include <type_traits>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief Minimal replacement for `std::inplace_vector` until the toolchain provides `<inplace_vector>`.
+     *
+     * Stores up to N elements inline and never allocates. Only provides the non-throwing subset, growing beyond the
+     * capacity is undefined behaviour. Only trivially copyable, default constructible types are supported.
+     */
+    template<typename T, size_t N>
+    class inplace_vector {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "inplace_vector only supports trivially copyable types");
+
+    public:
+        using value_type      = T;
+        using size_type       = size_t;
+        using reference       = T &;
+        using const_reference = const T &;
+        using iterator        = T *;
+        using const_iterator  = const T *;
+
+        constexpr inplace_vector() noexcept = default;
+
+        [[nodiscard]] constexpr T *data() noexcept { return mData; }
+        [[nodiscard]] constexpr const T *data() const noexcept { return mData; }
+
+        [[nodiscard]] constexpr size_t size() const noexcept { return mSize; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return mSize == 0; }
+        [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+        [[nodiscard]] static constexpr size_t max_size() noexcept { return N; }
+
+        constexpr T &operator[](const size_t index) noexcept { return mData[index]; }
+        constexpr const T &operator[](const size_t index) const noexcept { return mData[index]; }
+
+        constexpr iterator begin() noexcept { return mData; }
+        constexpr const_iterator begin() const noexcept { return mData; }
+        constexpr iterator end() noexcept { return mData + mSize; }
+        constexpr const_iterator end() const noexcept { return mData + mSize; }
+
+        /**
+         * @brief Appends a copy of `value`. Returns NULL if the vector is full.
+         */
+        constexpr T *try_push_back(const T &value) noexcept {
+            if (mSize == N) {
+                return nullptr;
+            }
+            mData[mSize] = value;
+            return std::addressof(mData[mSize++]);
+        }
+
+        constexpr void pop_back() noexcept { mSize--; }
+
+        constexpr void clear() noexcept { mSize = 0; }
+
+        /**
+         * @brief Resizes the vector to `count` elements, new elements are value-initialized. `count` must not exceed N.
+         */
+        constexpr void resize(const size_t count) noexcept {
+            for (size_t i = mSize; i < count; i++) {
+                mData[i] = T();
+            }
+            mSize = count;
+        }
+
+    private:
+        T mData[N > 0 ? N : 1] = {};
+        size_t mSize           = 0;
+    };
+} // namespace ButtonComboModule
+
+#endif
+
+#endif
\ No newline at end of file
@@ -1,9 +1,16 @@
+#include "ComboRegistry.h"
+#include "LabelString.h"
+#include "PendingTriggers.h"
+
 #include <buttoncombo/ButtonCombo.h>
 #include <buttoncombo/api.h>
 #include <buttoncombo/defines.h>
 
 #include <coreinit/debug.h>
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
 #include <stdexcept>
+#endif
 
 namespace ButtonComboModule {
 
@@ -17,6 +24,16 @@ namespace ButtonComboModule {
         return {};
     }
 
+    expected<ButtonCombo, ButtonComboModule_Error> ButtonCombo::TryCreate(const ButtonComboModule_ComboOptions &options,
+                                                                          ButtonComboModule_ComboStatus &outStatus) noexcept {
+        ButtonComboModule_ComboHandle handle;
+        if (const auto res = ButtonComboModule_AddButtonCombo(&options, &handle, &outStatus); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return unexpected(res);
+        }
+        return ButtonCombo(handle);
+    }
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
     ButtonCombo ButtonCombo::Create(const ButtonComboModule_ComboOptions &options,
                                     ButtonComboModule_ComboStatus &outStatus) {
         ButtonComboModule_Error error;
@@ -26,81 +43,55 @@ namespace ButtonComboModule {
         }
         return std::move(*res);
     }
+#endif
 
     ButtonCombo::~ButtonCombo() {
         ReleaseButtonComboHandle();
     }
 
+    uint32_t ButtonCombo::GetLiveCount() {
+        return ComboRegistry::GetLiveCount();
+    }
+
     void ButtonCombo::ReleaseButtonComboHandle() {
-        if (mHandle != nullptr) {
-            if (const auto res = ButtonComboModule_RemoveButtonCombo(mHandle); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
-                OSReport("ButtonCombo::ReleaseButtonComboHandle(): ButtonComboModule_RemoveButtonCombo for %p returned: %s\n", mHandle.handle, ButtonComboModule_GetStatusStr(res));
+        // The handle may have been released by ButtonComboModule_DeInitLibrary already.
+        if (const auto handle = ComboRegistry::Unlink(*this); handle != nullptr) {
+            PendingTriggers::Abort(handle);
+            if (const auto res = ButtonComboModule_RemoveButtonCombo(handle); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+                OSReport("ButtonCombo::ReleaseButtonComboHandle(): ButtonComboModule_RemoveButtonCombo for %p returned: %s\n", handle.handle, ButtonComboModule_GetStatusStr(res));
             }
-            mHandle = ButtonComboModule_ComboHandle(nullptr);
+            ComboRegistry::EndRelease();
         }
     }
 
     ButtonCombo::ButtonCombo(ButtonCombo &&src) noexcept {
-        ReleaseButtonComboHandle();
-
-        mHandle = src.mHandle;
-
-        src.mHandle = ButtonComboModule_ComboHandle(nullptr);
+        ComboRegistry::Replace(*this, src);
     }
 
     ButtonCombo &ButtonCombo::operator=(ButtonCombo &&src) noexcept {
         if (this != &src) {
             ReleaseButtonComboHandle();
 
-            mHandle = src.mHandle;
-
-            src.mHandle = ButtonComboModule_ComboHandle(nullptr);
+            ComboRegistry::Replace(*this, src);
         }
         return *this;
     }
 
-    [[nodiscard]] ButtonComboModule_ComboHandle ButtonCombo::getHandle() const {
-        return mHandle;
-    }
-
-    ButtonComboModule_Error ButtonCombo::GetButtonComboStatus(ButtonComboModule_ComboStatus &outStatus) const {
-        return ButtonComboModule_GetButtonComboStatus(mHandle, &outStatus);
-    }
-
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::UpdateButtonComboMeta(const ButtonComboModule_MetaOptions &metaOptions) const {
+    ButtonComboModule_Error ButtonCombo::UpdateLabel(const std::string_view label) const {
+        const LabelString labelString(label);
+        const ButtonComboModule_MetaOptions metaOptions = {.label = labelString.c_str()};
         return ButtonComboModule_UpdateButtonComboMeta(mHandle, &metaOptions);
     }
 
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::UpdateButtonComboCallback(const ButtonComboModule_CallbackOptions &callbackOptions) const {
-        return ButtonComboModule_UpdateButtonComboCallback(mHandle, &callbackOptions);
-    }
-
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::UpdateControllerMask(const ButtonComboModule_ControllerTypes controllerMask,
-                                                                            ButtonComboModule_ComboStatus &outStatus) const {
-        return ButtonComboModule_UpdateControllerMask(mHandle, controllerMask, &outStatus);
-    }
-
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::UpdateButtonCombo(const ButtonComboModule_Buttons combo,
-                                                                         ButtonComboModule_ComboStatus &outStatus) const {
-        return ButtonComboModule_UpdateButtonCombo(mHandle, combo, &outStatus);
-    }
-
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::UpdateHoldDuration(const uint32_t holdDurationInFrames) const {
-        return ButtonComboModule_UpdateHoldDuration(mHandle, holdDurationInFrames);
-    }
-
-    [[nodiscard]] ButtonComboModule_Error ButtonCombo::GetButtonComboMeta(ButtonComboModule_MetaOptionsOut &outOptions) const {
-        return ButtonComboModule_GetButtonComboMeta(mHandle, &outOptions);
-    }
-
-    ButtonComboModule_Error ButtonCombo::GetButtonComboCallback(ButtonComboModule_CallbackOptions &outOptions) const {
-        return ButtonComboModule_GetButtonComboCallback(mHandle, &outOptions);
-    }
-
-    ButtonComboModule_Error ButtonCombo::GetButtonComboInfoEx(ButtonComboModule_ButtonComboInfoEx &outOptions) const {
-        return ButtonComboModule_GetButtonComboInfoEx(mHandle, &outOptions);
+    ButtonComboModule_Error ButtonCombo::SetForegroundLifecycleExempt(const bool exempt) {
+        const auto res = ButtonComboModule_SetButtonComboSuspendExempt(mHandle, exempt);
+        if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            mLifecycleExempt = exempt;
+        }
+        return res;
     }
 
     ButtonCombo::ButtonCombo(const ButtonComboModule_ComboHandle handle) : mHandle(handle) {
+        ComboRegistry::Link(*this);
     }
 } // namespace ButtonComboModule
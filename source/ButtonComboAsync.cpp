@@ -0,0 +1,123 @@
+#include "CallbackRedirect.h"
+#include "PendingTriggers.h"
+
+#include <buttoncombo/ButtonCombo.h>
+#include <buttoncombo/ButtonComboAsync.h>
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/debug.h>
+
+namespace ButtonComboModule {
+
+    FrameExecutor &FrameExecutor::Main() {
+        static FrameExecutor sMainExecutor;
+        return sMainExecutor;
+    }
+
+    void FrameExecutor::Post(ExecutorNode &node) noexcept {
+        ExecutorNode *head = mReady.load(std::memory_order_relaxed);
+        do {
+            node.mNext = head;
+        } while (!mReady.compare_exchange_weak(head, &node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    uint32_t FrameExecutor::Pump() noexcept {
+        ExecutorNode *node = mReady.exchange(nullptr, std::memory_order_acquire);
+
+        // The ready list is LIFO, reverse it to resume coroutines in the order they became ready.
+        ExecutorNode *ordered = nullptr;
+        while (node != nullptr) {
+            ExecutorNode *next = node->mNext;
+            node->mNext        = ordered;
+            ordered            = node;
+            node               = next;
+        }
+
+        uint32_t resumed = 0;
+        while (ordered != nullptr) {
+            // The node lives in the coroutine frame and may be gone after resuming.
+            ExecutorNode *next = ordered->mNext;
+            ordered->mContinuation.resume();
+            ordered = next;
+            resumed++;
+        }
+        return resumed;
+    }
+
+    TriggerAwaiter ButtonCombo::NextTrigger() const {
+        return TriggerAwaiter(mHandle, FrameExecutor::Main());
+    }
+
+    TriggerAwaiter ButtonCombo::NextTrigger(FrameExecutor &executor) const {
+        return TriggerAwaiter(mHandle, executor);
+    }
+
+    DetectAwaiter DetectButtonComboAsync(const ButtonComboModule_DetectButtonComboOptions &options,
+                                         FrameExecutor &executor) {
+        return DetectAwaiter(options, executor);
+    }
+
+    TriggerAwaiter::TriggerAwaiter(const ButtonComboModule_ComboHandle handle, FrameExecutor &executor) noexcept : mHandle(handle), mExecutor(&executor) {
+    }
+
+    bool TriggerAwaiter::await_suspend(const std::coroutine_handle<> continuation) noexcept {
+        if (mHandle == nullptr) {
+            mResult.error = BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+            return false;
+        }
+        if (mResult.error = GetRedirectableCallback(mHandle, mPrevCallbackOptions); mResult.error != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return false;
+        }
+
+        // The combo may trigger on the input thread as soon as the callback has been swapped.
+        mContinuation = continuation;
+        PendingTriggers::Link(*this);
+        const ButtonComboModule_CallbackOptions options = {.callback = OnTrigger, .context = this};
+        if (const auto res = ButtonComboModule_UpdateButtonComboCallback(mHandle, &options); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            // The combo may have been released in between, then the awaiter has already been posted with ABORTED.
+            if (!PendingTriggers::Unlink(*this)) {
+                return true;
+            }
+            mResult.error = res;
+            return false;
+        }
+        return true;
+    }
+
+    TriggerResult TriggerAwaiter::await_resume() noexcept {
+        if (mFired) {
+            if (const auto res = ButtonComboModule_UpdateButtonComboCallback(mHandle, &mPrevCallbackOptions); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+                OSReport("TriggerAwaiter::await_resume(): Failed to restore callback for %p: %s\n", mHandle.handle, ButtonComboModule_GetStatusStr(res));
+                mResult.error = res;
+            }
+        }
+        return mResult;
+    }
+
+    void TriggerAwaiter::OnTrigger(const ButtonComboModule_ControllerTypes triggeredBy, const ButtonComboModule_ComboHandle handle, void *context) {
+        // Triggers that happen before the original callback has been restored find the awaiter completed, its frame
+        // may be gone already.
+        PendingTriggers::Complete(context, handle, triggeredBy);
+    }
+
+    DetectAwaiter::DetectAwaiter(const ButtonComboModule_DetectButtonComboOptions &options, FrameExecutor &executor) noexcept : mOptions(options), mExecutor(&executor) {
+    }
+
+    bool DetectAwaiter::await_suspend(const std::coroutine_handle<> continuation) noexcept {
+        mContinuation = continuation;
+        // On success, mResult is owned by OnDetected which may already run on the input thread.
+        if (const auto res = ButtonComboModule_DetectButtonCombo_Async(&mOptions, OnDetected, this); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            mResult.error = res;
+            return false;
+        }
+        return true;
+    }
+
+    void DetectAwaiter::OnDetected(const ButtonComboModule_Error error, const ButtonComboModule_Buttons buttons, void *context) {
+        auto *self            = static_cast<DetectAwaiter *>(context);
+        self->mResult.error   = error;
+        self->mResult.buttons = buttons;
+        self->mExecutor->Post(*self);
+    }
+} // namespace ButtonComboModule
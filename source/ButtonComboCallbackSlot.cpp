@@ -0,0 +1,45 @@
+#include <buttoncombo/ButtonCombo.h>
+#include <buttoncombo/ButtonComboCallbackSlot.h>
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/debug.h>
+
+namespace ButtonComboModule {
+
+    CallbackSlot::CallbackSlot(const ButtonCombo &combo) {
+        mError     = ButtonComboModule_InstallCallbackSlot(combo.getHandle(), &mSlot);
+        mInstalled = mError == BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    CallbackSlot::~CallbackSlot() {
+        if (!mInstalled) {
+            return;
+        }
+        // The combo is usually removed first, then there is no callback left to hand back.
+        if (const auto res = Uninstall(); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS && res != BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT) {
+            OSReport("CallbackSlot::~CallbackSlot(): Failed to restore callback for %p: %s\n", mSlot.handle.handle, ButtonComboModule_GetStatusStr(res));
+        }
+    }
+
+    ButtonComboModule_Error CallbackSlot::Swap(const ButtonComboModule_ComboCallback callback,
+                                               void *context,
+                                               ButtonComboModule_CallbackOptions *outOldOptions) {
+        if (mError != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return mError;
+        }
+        if (!mInstalled) {
+            return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+        }
+        const ButtonComboModule_CallbackOptions options = {.callback = callback, .context = context};
+        return ButtonComboModule_SwapCallback(&mSlot, &options, outOldOptions);
+    }
+
+    ButtonComboModule_Error CallbackSlot::Uninstall() {
+        if (!mInstalled) {
+            return mError;
+        }
+        mInstalled = false;
+        return ButtonComboModule_UninstallCallbackSlot(&mSlot);
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
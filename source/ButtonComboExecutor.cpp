@@ -0,0 +1,95 @@
+#include <buttoncombo/ButtonCombo.h>
+#include <buttoncombo/ButtonComboExecutor.h>
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/debug.h>
+#ifdef __WIIU__
+#include <coreinit/thread.h>
+#endif
+
+namespace ButtonComboModule {
+
+    ThreadExecutor::ThreadExecutor(const int32_t core) {
+#ifdef __WIIU__
+        OSInitEvent(&mPostedEvent, FALSE, OS_EVENT_MODE_AUTO);
+#endif
+        // Started last, the worker must not wait before the event has been initialized.
+        mThread = std::thread(&ThreadExecutor::Run, this, core);
+    }
+
+    ThreadExecutor::~ThreadExecutor() {
+        mStop.store(true, std::memory_order_release);
+        Wake();
+        mThread.join();
+    }
+
+    bool ThreadExecutor::Post(const ButtonComboModule_TriggerRecord &record) noexcept {
+        if (!mQueue.Post(record)) {
+            return false;
+        }
+        Wake();
+        return true;
+    }
+
+    void ThreadExecutor::Wake() noexcept {
+#ifdef __WIIU__
+        // Auto reset, a signal without a waiting worker stays set until the worker waits again.
+        OSSignalEvent(&mPostedEvent);
+#else
+        mPosted.fetch_add(1, std::memory_order_release);
+        mPosted.notify_one();
+#endif
+    }
+
+    void ThreadExecutor::Run(const int32_t core) {
+#ifdef __WIIU__
+        if (core >= 0 && core <= 2) {
+            OSSetThreadAffinity(OSGetCurrentThread(), static_cast<OSThreadAttributes>(OS_THREAD_ATTRIB_AFFINITY_CPU0 << core));
+        }
+#else
+        (void) core;
+#endif
+#ifndef __WIIU__
+        uint32_t seen = 0;
+#endif
+        while (true) {
+#ifdef __WIIU__
+            OSWaitEvent(&mPostedEvent);
+#else
+            mPosted.wait(seen, std::memory_order_acquire);
+            seen = mPosted.load(std::memory_order_acquire);
+#endif
+            mQueue.Drain();
+            if (mStop.load(std::memory_order_acquire)) {
+                // Run everything that has been posted before the executor has been destroyed.
+                mQueue.Drain();
+                break;
+            }
+        }
+    }
+
+    ExecutorBinding::ExecutorBinding(const ButtonCombo &combo, CallbackExecutor &executor) {
+        const auto cExecutor = executor.AsCExecutor();
+        mError               = ButtonComboModule_BindExecutor(combo.getHandle(), &cExecutor, &mBinding);
+        mBound               = mError == BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    ExecutorBinding::~ExecutorBinding() {
+        if (!mBound) {
+            return;
+        }
+        // The combo is usually removed first, then there is no callback left to restore.
+        if (const auto res = Unbind(); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS && res != BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT) {
+            OSReport("ExecutorBinding::~ExecutorBinding(): Failed to restore callback for %p: %s\n", mBinding.handle.handle, ButtonComboModule_GetStatusStr(res));
+        }
+    }
+
+    ButtonComboModule_Error ExecutorBinding::Unbind() {
+        if (!mBound) {
+            return mError;
+        }
+        mBound = false;
+        return ButtonComboModule_UnbindExecutor(&mBinding);
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
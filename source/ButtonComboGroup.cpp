@@ -0,0 +1,83 @@
+#include <buttoncombo/ButtonCombo.h>
+#include <buttoncombo/ButtonComboGroup.h>
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/debug.h>
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
+#include <stdexcept>
+#endif
+
+namespace ButtonComboModule {
+
+    std::optional<ButtonComboGroup> ButtonComboGroup::Create(ButtonComboModule_Error &outError) noexcept {
+        ButtonComboModule_ComboGroupHandle handle;
+        if (outError = ButtonComboModule_CreateComboGroup(&handle); outError == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return ButtonComboGroup(handle);
+        }
+        return {};
+    }
+
+    expected<ButtonComboGroup, ButtonComboModule_Error> ButtonComboGroup::TryCreate() noexcept {
+        ButtonComboModule_ComboGroupHandle handle;
+        if (const auto res = ButtonComboModule_CreateComboGroup(&handle); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return unexpected(res);
+        }
+        return ButtonComboGroup(handle);
+    }
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
+    ButtonComboGroup ButtonComboGroup::Create() {
+        ButtonComboModule_Error error;
+        auto res = Create(error);
+        if (!res) {
+            throw std::runtime_error{std::string("Failed to create combo group: ").append(ButtonComboModule_GetStatusStr(error))};
+        }
+        return std::move(*res);
+    }
+#endif
+
+    ButtonComboGroup::~ButtonComboGroup() {
+        ReleaseGroupHandle();
+    }
+
+    void ButtonComboGroup::ReleaseGroupHandle() {
+        if (mHandle == nullptr) {
+            return;
+        }
+        if (const auto res = ButtonComboModule_DestroyComboGroup(mHandle); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            OSReport("ButtonComboGroup::ReleaseGroupHandle(): ButtonComboModule_DestroyComboGroup for %p returned: %s\n", mHandle.handle, ButtonComboModule_GetStatusStr(res));
+        }
+        mHandle = ButtonComboModule_ComboGroupHandle(nullptr);
+    }
+
+    ButtonComboGroup::ButtonComboGroup(ButtonComboGroup &&src) noexcept : mHandle(src.mHandle) {
+        src.mHandle = ButtonComboModule_ComboGroupHandle(nullptr);
+    }
+
+    ButtonComboGroup &ButtonComboGroup::operator=(ButtonComboGroup &&src) noexcept {
+        if (this != &src) {
+            ReleaseGroupHandle();
+
+            mHandle     = src.mHandle;
+            src.mHandle = ButtonComboModule_ComboGroupHandle(nullptr);
+        }
+        return *this;
+    }
+
+    ButtonComboModule_Error ButtonComboGroup::Add(const ButtonCombo &combo) const {
+        return ButtonComboModule_AddToComboGroup(mHandle, combo.getHandle());
+    }
+
+    ButtonComboModule_Error ButtonComboGroup::Remove(const ButtonCombo &combo) const {
+        return ButtonComboModule_RemoveFromComboGroup(mHandle, combo.getHandle());
+    }
+
+    ButtonComboModule_Error ButtonComboGroup::SetEnabled(const bool enabled) const {
+        return ButtonComboModule_SetComboGroupEnabled(mHandle, enabled);
+    }
+
+    ButtonComboGroup::ButtonComboGroup(const ButtonComboModule_ComboGroupHandle handle) : mHandle(handle) {
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include <buttoncombo/ButtonComboInjection.h>
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/debug.h>
+
+#include <atomic>
+
+namespace ButtonComboModule {
+
+    namespace {
+        // Last mask set by an InputInjection, used if the module can't report the current mask.
+        std::atomic<uint32_t> sLastMask = BUTTON_COMBO_MODULE_CONTROLLER_NONE;
+
+        ButtonComboModule_Error SetMask(const ButtonComboModule_ControllerTypes mask) {
+            const auto res = ButtonComboModule_SetRealInputMask(mask);
+            if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+                sLastMask = mask;
+            }
+            return res;
+        }
+    } // namespace
+
+    InputInjection::InputInjection(const ButtonComboModule_ControllerTypes maskedControllers) : mMaskedControllers(maskedControllers) {
+        if (mMaskedControllers == BUTTON_COMBO_MODULE_CONTROLLER_NONE) {
+            return;
+        }
+        if (mError = ButtonComboModule_GetRealInputMask(&mPreviousMask); mError == BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND) {
+            mPreviousMask = static_cast<ButtonComboModule_ControllerTypes>(sLastMask.load());
+        } else if (mError != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return;
+        }
+        mError = SetMask(static_cast<ButtonComboModule_ControllerTypes>(mPreviousMask | mMaskedControllers));
+    }
+
+    InputInjection::~InputInjection() {
+        if (mMaskedControllers == BUTTON_COMBO_MODULE_CONTROLLER_NONE || mError != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return;
+        }
+        if (const auto res = SetMask(mPreviousMask); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            OSReport("InputInjection::~InputInjection(): Failed to restore the real input mask: %s\n", ButtonComboModule_GetStatusStr(res));
+        }
+    }
+
+    ButtonComboModule_Error InputInjection::Inject(const ButtonComboModule_ControllerTypes controller,
+                                                   const ButtonComboModule_Buttons buttons,
+                                                   const OSTime sampleTime) const {
+        const ButtonComboModule_InputSample sample = {.controller = controller, .buttons = buttons, .sampleTime = sampleTime};
+        return ButtonComboModule_InjectInput(&sample, 1);
+    }
+
+    ButtonComboModule_Error InputInjection::Inject(const std::span<const ButtonComboModule_InputSample> samples) const {
+        return ButtonComboModule_InjectInput(samples.data(), static_cast<uint32_t>(samples.size()));
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
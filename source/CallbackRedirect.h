@@ -0,0 +1,29 @@
+#pragma once
+
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief Reads the callback of a combo before it's redirected to one of the trampolines of this library.
+     *
+     * Redirecting only replaces the plain callback. A @ref ButtonComboModule_ComboCallbackEx would still be called
+     * instead of the trampoline, with the trampoline's context, so those combos are rejected with
+     * BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND.
+     */
+    inline ButtonComboModule_Error GetRedirectableCallback(const ButtonComboModule_ComboHandle handle, ButtonComboModule_CallbackOptions &outOptions) {
+        if (const auto res = ButtonComboModule_GetButtonComboCallback(handle, &outOptions); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            return res;
+        }
+        ButtonComboModule_ComboCallbackEx callbackEx = nullptr;
+        if (const auto res = ButtonComboModule_GetButtonComboCallbackEx(handle, &callbackEx); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS && res != BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND) {
+            return res;
+        }
+        // Without the export, a missing plain callback is the only hint that an extended one is used.
+        if (callbackEx != nullptr || outOptions.callback == nullptr) {
+            return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+        }
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "ComboRegistry.h"
+#include "PendingTriggers.h"
+#include "logger.h"
+
+#include <buttoncombo/api.h>
+
+#include <coreinit/thread.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace ButtonComboModule {
+
+    namespace {
+        std::mutex sRegistryMutex;
+        ButtonCombo *sHead  = nullptr;
+        uint32_t sLiveCount = 0;
+        // Handles that have been unlinked, but not removed from the module yet.
+        std::atomic<uint32_t> sPendingReleases = 0;
+
+        // Handles are released in chunks so ReleaseAll doesn't need to allocate.
+        constexpr uint32_t RELEASE_CHUNK_SIZE = 32;
+    } // namespace
+
+    void ComboRegistry::Link(ButtonCombo &combo) {
+        std::lock_guard lock(sRegistryMutex);
+        combo.mPrev = nullptr;
+        combo.mNext = sHead;
+        if (sHead != nullptr) {
+            sHead->mPrev = &combo;
+        }
+        sHead = &combo;
+        sLiveCount++;
+    }
+
+    ButtonComboModule_ComboHandle ComboRegistry::Unlink(ButtonCombo &combo) {
+        std::lock_guard lock(sRegistryMutex);
+        const auto handle = combo.mHandle;
+        if (handle == nullptr) {
+            return handle;
+        }
+        if (combo.mPrev != nullptr) {
+            combo.mPrev->mNext = combo.mNext;
+        } else {
+            sHead = combo.mNext;
+        }
+        if (combo.mNext != nullptr) {
+            combo.mNext->mPrev = combo.mPrev;
+        }
+        combo.mPrev   = nullptr;
+        combo.mNext   = nullptr;
+        combo.mHandle = ButtonComboModule_ComboHandle(nullptr);
+        sLiveCount--;
+        sPendingReleases++;
+        return handle;
+    }
+
+    void ComboRegistry::EndRelease() {
+        sPendingReleases--;
+    }
+
+    void ComboRegistry::Replace(ButtonCombo &dst, ButtonCombo &src) {
+        std::lock_guard lock(sRegistryMutex);
+        dst.mHandle          = src.mHandle;
+        dst.mPrev            = src.mPrev;
+        dst.mNext            = src.mNext;
+        dst.mLifecycleExempt = src.mLifecycleExempt;
+        if (dst.mHandle != nullptr) {
+            if (dst.mPrev != nullptr) {
+                dst.mPrev->mNext = &dst;
+            } else {
+                sHead = &dst;
+            }
+            if (dst.mNext != nullptr) {
+                dst.mNext->mPrev = &dst;
+            }
+        }
+        src.mHandle = ButtonComboModule_ComboHandle(nullptr);
+        src.mPrev   = nullptr;
+        src.mNext   = nullptr;
+    }
+
+    void ComboRegistry::ReleaseAll() {
+        ButtonComboModule_ComboHandle handles[RELEASE_CHUNK_SIZE];
+        while (true) {
+            uint32_t count = 0;
+            {
+                // The module may wait for running callbacks, which in turn may destroy combos. Don't hold the lock while removing.
+                std::lock_guard lock(sRegistryMutex);
+                while (sHead != nullptr && count < RELEASE_CHUNK_SIZE) {
+                    ButtonCombo *combo = sHead;
+                    sHead              = combo->mNext;
+                    handles[count++]   = combo->mHandle;
+                    combo->mHandle     = ButtonComboModule_ComboHandle(nullptr);
+                    combo->mPrev       = nullptr;
+                    combo->mNext       = nullptr;
+                }
+                if (sHead != nullptr) {
+                    sHead->mPrev = nullptr;
+                }
+                sLiveCount -= count;
+            }
+            if (count == 0) {
+                break;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                PendingTriggers::Abort(handles[i]);
+            }
+
+            auto res = ButtonComboModule_RemoveButtonCombos(handles, count);
+            if (res == BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND) {
+                // Older modules can only remove one combo at a time.
+                res = BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+                for (uint32_t i = 0; i < count; i++) {
+                    if (const auto removeRes = ButtonComboModule_RemoveButtonCombo(handles[i]); removeRes != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+                        res = removeRes;
+                    }
+                }
+            }
+            if (res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+                DEBUG_FUNCTION_LINE_WARN("Failed to release %d button combo(s): %s", static_cast<int>(count), ButtonComboModule_GetStatusStr(res));
+            }
+        }
+
+        // Combos that are destroyed right now have unlinked themselves before, but still need the exports to remove
+        // their handle.
+        while (sPendingReleases.load() != 0) {
+            OSYieldThread();
+        }
+    }
+
+    uint32_t ComboRegistry::GetLiveCount() {
+        std::lock_guard lock(sRegistryMutex);
+        return sLiveCount;
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <buttoncombo/ButtonCombo.h>
+
+#include <cstdint>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief Intrusive list of all ButtonCombo objects that currently own a handle.
+     *
+     * Allows @ref ButtonComboModule_DeInitLibrary to release combos that are still alive. The list nodes live inside
+     * the ButtonCombo objects, registering a combo never allocates.
+     */
+    class ComboRegistry {
+    public:
+        static void Link(ButtonCombo &combo);
+
+        /**
+         * @brief Unlinks the combo and takes its handle. Returns a NULL handle if the combo has already been detached.
+         *
+         * A non-NULL handle has to be removed from the module and then be followed by @ref EndRelease,
+         * @ref ReleaseAll waits for this before the library is deinitialized.
+         */
+        static ButtonComboModule_ComboHandle Unlink(ButtonCombo &combo);
+
+        static void EndRelease();
+
+        /**
+         * @brief Moves the handle and the list position of `src` to `dst`. `dst` must not own a handle.
+         */
+        static void Replace(ButtonCombo &dst, ButtonCombo &src);
+
+        /**
+         * @brief Removes all registered combos from the module and detaches the ButtonCombo objects.
+         *
+         * Must be called while the library is still initialized. Also waits for handles returned by @ref Unlink that
+         * are still being removed.
+         */
+        static void ReleaseAll();
+
+        static uint32_t GetLiveCount();
+    };
+} // namespace ButtonComboModule
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "logger.h"
+
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <proc_ui/procui.h>
+
+#include <mutex>
+
+namespace {
+    constexpr uint32_t PROCUI_CALLBACK_PRIORITY = 100;
+
+    // Serializes enabling and disabling the mode with the ProcUI callbacks.
+    std::mutex sLifecycleMutex;
+    bool sLifecycleEnabled = false;
+    // ProcUI callbacks can't be unregistered, they are registered once and do nothing while the mode is disabled.
+    bool sCallbacksRegistered = false;
+
+    void SetSuspended(const bool suspended) {
+        std::lock_guard lock(sLifecycleMutex);
+        if (!sLifecycleEnabled) {
+            return;
+        }
+        if (const auto res = ButtonComboModule_SetClientSuspended(suspended); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            DEBUG_FUNCTION_LINE_WARN("Failed to %s the combos: %s", suspended ? "suspend" : "resume", ButtonComboModule_GetStatusStr(res));
+        }
+    }
+
+    uint32_t OnReleaseForeground(void *) {
+        SetSuspended(true);
+        return 0;
+    }
+
+    uint32_t OnAcquireForeground(void *) {
+        SetSuspended(false);
+        return 0;
+    }
+} // namespace
+
+ButtonComboModule_Error ButtonComboModule_SetForegroundLifecycleEnabled(const bool enabled) {
+    std::lock_guard lock(sLifecycleMutex);
+    if (!enabled) {
+        if (!sLifecycleEnabled) {
+            return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+        }
+        sLifecycleEnabled = false;
+        return ButtonComboModule_SetClientSuspended(false);
+    }
+    if (sLifecycleEnabled) {
+        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+    }
+
+    // The app is in the foreground while it enables the mode, this also checks that the module supports it.
+    if (const auto res = ButtonComboModule_SetClientSuspended(false); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        return res;
+    }
+    if (!sCallbacksRegistered) {
+        ProcUIRegisterCallback(PROCUI_CALLBACK_RELEASE, OnReleaseForeground, nullptr, PROCUI_CALLBACK_PRIORITY);
+        ProcUIRegisterCallback(PROCUI_CALLBACK_ACQUIRE, OnAcquireForeground, nullptr, PROCUI_CALLBACK_PRIORITY);
+        sCallbacksRegistered = true;
+    }
+    sLifecycleEnabled = true;
+    return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+}
\ No newline at end of file
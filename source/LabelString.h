@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+
+namespace ButtonComboModule {
+
+    /**
+     * @brief NUL-terminated copy of a label that may come from a non-terminated std::string_view.
+     *
+     * Labels up to INLINE_SIZE - 1 characters are copied into an inline buffer and never allocate. Longer labels fall
+     * back to the heap, and are truncated to the inline size if that allocation fails.
+     * Has to outlive the call the label is passed to, the module copies the label.
+     */
+    class LabelString {
+    public:
+        static constexpr uint32_t INLINE_SIZE = 64;
+
+        explicit LabelString(const std::string_view label) {
+            size_t length = label.size();
+            if (length >= INLINE_SIZE) {
+                mHeap = new (std::nothrow) char[length + 1];
+                if (mHeap == nullptr) {
+                    length = INLINE_SIZE - 1;
+                }
+            }
+            char *dst = mHeap != nullptr ? mHeap : mInline;
+            if (length > 0) {
+                memcpy(dst, label.data(), length);
+            }
+            dst[length] = '\0';
+        }
+
+        ~LabelString() {
+            delete[] mHeap;
+        }
+
+        LabelString(const LabelString &)            = delete;
+        LabelString &operator=(const LabelString &) = delete;
+
+        [[nodiscard]] const char *c_str() const {
+            return mHeap != nullptr ? mHeap : mInline;
+        }
+
+    private:
+        char mInline[INLINE_SIZE];
+        char *mHeap = nullptr;
+    };
+} // namespace ButtonComboModule
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "PendingTriggers.h"
+
+#include <buttoncombo/ButtonComboAsync.h>
+
+#include <mutex>
+
+namespace ButtonComboModule {
+
+    namespace {
+        // Only held while awaiters are linked, unlinked or posted, never while a coroutine runs.
+        std::mutex sPendingMutex;
+        TriggerAwaiter *sHead = nullptr;
+    } // namespace
+
+    void PendingTriggers::Link(TriggerAwaiter &awaiter) {
+        std::lock_guard lock(sPendingMutex);
+        awaiter.mPrevPending = nullptr;
+        awaiter.mNextPending = sHead;
+        if (sHead != nullptr) {
+            sHead->mPrevPending = &awaiter;
+        }
+        sHead = &awaiter;
+    }
+
+    bool PendingTriggers::Unlink(TriggerAwaiter &awaiter) {
+        std::lock_guard lock(sPendingMutex);
+        for (auto *pending = sHead; pending != nullptr; pending = pending->mNextPending) {
+            if (pending == &awaiter) {
+                UnlinkLocked(awaiter);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void PendingTriggers::Complete(const void *context, const ButtonComboModule_ComboHandle handle, const ButtonComboModule_ControllerTypes triggeredBy) {
+        std::lock_guard lock(sPendingMutex);
+        for (auto *pending = sHead; pending != nullptr; pending = pending->mNextPending) {
+            // A new awaiter may live at the address of a completed one, only accept triggers of its own combo.
+            if (pending == context && pending->mHandle == handle) {
+                UnlinkLocked(*pending);
+                pending->mFired              = true;
+                pending->mResult.triggeredBy = triggeredBy;
+                pending->mExecutor->Post(*pending);
+                return;
+            }
+        }
+    }
+
+    void PendingTriggers::Abort(const ButtonComboModule_ComboHandle handle) {
+        std::lock_guard lock(sPendingMutex);
+        auto *pending = sHead;
+        while (pending != nullptr) {
+            auto *next = pending->mNextPending;
+            if (pending->mHandle == handle) {
+                UnlinkLocked(*pending);
+                pending->mResult.error = BUTTON_COMBO_MODULE_ERROR_ABORTED;
+                pending->mExecutor->Post(*pending);
+            }
+            pending = next;
+        }
+    }
+
+    void PendingTriggers::UnlinkLocked(TriggerAwaiter &awaiter) {
+        if (awaiter.mPrevPending != nullptr) {
+            awaiter.mPrevPending->mNextPending = awaiter.mNextPending;
+        } else {
+            sHead = awaiter.mNextPending;
+        }
+        if (awaiter.mNextPending != nullptr) {
+            awaiter.mNextPending->mPrevPending = awaiter.mPrevPending;
+        }
+        awaiter.mPrevPending = nullptr;
+        awaiter.mNextPending = nullptr;
+    }
+} // namespace ButtonComboModule
\ No newline at end of file
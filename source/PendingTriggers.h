@@ -0,0 +1,41 @@
+#pragma once
+
+#include <buttoncombo/defines.h>
+
+namespace ButtonComboModule {
+
+    class TriggerAwaiter;
+
+    /**
+     * @brief Intrusive list of all TriggerAwaiters whose coroutine is suspended.
+     *
+     * The module may still call the trampoline of an awaiter after the coroutine has been resumed and its frame has been
+     * released, so a trigger only uses an awaiter that is still in this list. The list nodes live inside the awaiters,
+     * registering an awaiter never allocates.
+     */
+    class PendingTriggers {
+    public:
+        static void Link(TriggerAwaiter &awaiter);
+
+        /**
+         * @brief Unlinks the awaiter. Returns false if it has already been completed or aborted.
+         */
+        static bool Unlink(TriggerAwaiter &awaiter);
+
+        /**
+         * @brief Posts the awaiter `context` points to with the trigger, if it's still pending for this combo. `context`
+         * is not dereferenced otherwise.
+         */
+        static void Complete(const void *context, ButtonComboModule_ComboHandle handle, ButtonComboModule_ControllerTypes triggeredBy);
+
+        /**
+         * @brief Posts all pending awaiters of the combo with BUTTON_COMBO_MODULE_ERROR_ABORTED.
+         *
+         * Has to be called before the handle is removed from the module, the awaiters don't restore the callback then.
+         */
+        static void Abort(ButtonComboModule_ComboHandle handle);
+
+    private:
+        static void UnlinkLocked(TriggerAwaiter &awaiter);
+    };
+} // namespace ButtonComboModule
\ No newline at end of file
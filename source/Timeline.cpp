@@ -0,0 +1,112 @@
+#include <buttoncombo/api.h>
+#include <buttoncombo/defines.h>
+
+#include <coreinit/time.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+    const ButtonComboModule_TimelineEvent &GetEvent(const ButtonComboModule_TimelineRecorder &recorder, const uint32_t index) {
+        // Oldest event first, the ring buffer may have wrapped around.
+        const uint32_t start = recorder.totalCount > recorder.capacity ? recorder.totalCount % recorder.capacity : 0;
+        return recorder.events[(start + index) % recorder.capacity];
+    }
+
+    struct ComboEntry {
+        uintptr_t handle;
+        uint32_t index; // Position of the first event of the combo, the index of the combo inside the dump after CollectCombos
+    };
+
+    bool ByHandle(const ComboEntry &a, const ComboEntry &b) {
+        return a.handle < b.handle || (a.handle == b.handle && a.index < b.index);
+    }
+
+    /**
+     * Fills `entries` (room for `eventCount` entries) with the distinct combos of the events, sorted by handle.
+     * Combos are indexed in the order of their first event. Returns the number of combos.
+     */
+    uint32_t CollectCombos(const ButtonComboModule_TimelineRecorder &recorder, const uint32_t eventCount, ComboEntry *entries) {
+        for (uint32_t i = 0; i < eventCount; i++) {
+            entries[i] = {reinterpret_cast<uintptr_t>(GetEvent(recorder, i).handle.handle), i};
+        }
+        std::sort(entries, entries + eventCount, ByHandle);
+        const auto count = static_cast<uint32_t>(std::unique(entries, entries + eventCount, [](const ComboEntry &a, const ComboEntry &b) { return a.handle == b.handle; }) - entries);
+
+        std::sort(entries, entries + count, [](const ComboEntry &a, const ComboEntry &b) { return a.index < b.index; });
+        for (uint32_t i = 0; i < count; i++) {
+            entries[i].index = i;
+        }
+        std::sort(entries, entries + count, ByHandle);
+        return count;
+    }
+
+    uint32_t FindCombo(const ComboEntry *entries, const uint32_t count, const ButtonComboModule_ComboHandle handle) {
+        const ComboEntry key = {reinterpret_cast<uintptr_t>(handle.handle), 0};
+        return std::lower_bound(entries, entries + count, key, ByHandle)->index;
+    }
+} // namespace
+
+ButtonComboModule_Error ButtonComboModule_WriteTimelineDump(const ButtonComboModule_TimelineRecorder *recorder,
+                                                            void *buffer,
+                                                            const uint32_t bufferSize,
+                                                            uint32_t *outRequiredSize) {
+    if (recorder == nullptr || outRequiredSize == nullptr || (recorder->events == nullptr && recorder->totalCount != 0) ||
+        (buffer == nullptr && bufferSize != 0) || (reinterpret_cast<uintptr_t>(buffer) % alignof(ButtonComboModule_TimelineDumpEvent)) != 0 ||
+        __atomic_load_n(&recorder->recording, __ATOMIC_ACQUIRE) != 0) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+
+    const uint32_t eventCount = std::min(recorder->totalCount, recorder->capacity);
+    std::unique_ptr<ComboEntry[]> entries(new (std::nothrow) ComboEntry[std::max(eventCount, 1u)]);
+    if (!entries) {
+        return BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR;
+    }
+    const uint32_t comboCount  = CollectCombos(*recorder, eventCount, entries.get());
+    const uint32_t comboOffset = sizeof(ButtonComboModule_TimelineDumpHeader) + eventCount * sizeof(ButtonComboModule_TimelineDumpEvent);
+    *outRequiredSize           = comboOffset + comboCount * sizeof(ButtonComboModule_TimelineDumpCombo);
+    if (bufferSize < *outRequiredSize) {
+        return BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    auto *data   = static_cast<uint8_t *>(buffer);
+    auto *header = reinterpret_cast<ButtonComboModule_TimelineDumpHeader *>(data);
+    auto *events = reinterpret_cast<ButtonComboModule_TimelineDumpEvent *>(data + sizeof(ButtonComboModule_TimelineDumpHeader));
+    auto *combos = reinterpret_cast<ButtonComboModule_TimelineDumpCombo *>(data + comboOffset);
+
+    *header = {.magic          = BUTTON_COMBO_MODULE_TIMELINE_DUMP_MAGIC,
+               .version        = BUTTON_COMBO_MODULE_TIMELINE_DUMP_VERSION,
+               .headerSize     = sizeof(ButtonComboModule_TimelineDumpHeader),
+               .eventSize      = sizeof(ButtonComboModule_TimelineDumpEvent),
+               .eventCount     = eventCount,
+               .droppedCount   = recorder->totalCount - eventCount,
+               .comboOffset    = comboOffset,
+               .comboSize      = sizeof(ButtonComboModule_TimelineDumpCombo),
+               .comboCount     = comboCount,
+               .ticksPerSecond = static_cast<uint32_t>(OSMillisecondsToTicks(1000))};
+
+    for (uint32_t i = 0; i < eventCount; i++) {
+        const auto &event = GetEvent(*recorder, i);
+        events[i]         = {.sampleTime    = event.sampleTime,
+                             .comboIndex    = FindCombo(entries.get(), comboCount, event.handle),
+                             .controller    = static_cast<uint32_t>(event.controller),
+                             .previousState = static_cast<uint32_t>(event.previousState),
+                             .state         = static_cast<uint32_t>(event.state),
+                             .heldForInMs   = event.heldForInMs,
+                             .reserved      = 0};
+    }
+
+    for (uint32_t i = 0; i < comboCount; i++) {
+        auto &combo = combos[entries[i].index];
+        memset(combo.label, 0, sizeof(combo.label));
+
+        const char *label = nullptr;
+        uint32_t length   = 0;
+        if (ButtonComboModule_GetButtonComboLabel(ButtonComboModule_ComboHandle(reinterpret_cast<void *>(entries[i].handle)), &label, &length) == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+            memcpy(combo.label, label, std::min<uint32_t>(length, sizeof(combo.label) - 1));
+        }
+    }
+    return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+}
\ No newline at end of file
@@ -1,11 +1,80 @@
+#include "LabelString.h"
 #include "buttoncombo/ButtonCombo.h"
 #include "buttoncombo/api.h"
 #include "buttoncombo/defines.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
 #include <optional>
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
 #include <stdexcept>
+#endif
 
 namespace ButtonComboModule {
+    namespace {
+        ButtonComboModule_ComboOptions MakePressDownOptions(const char *label,
+                                                            const ButtonComboModule_ControllerTypes controllerMask,
+                                                            const ButtonComboModule_Buttons combo,
+                                                            const ButtonComboModule_ComboCallback callback,
+                                                            void *context,
+                                                            const bool observer) {
+            ButtonComboModule_ComboOptions options               = {};
+            options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
+            options.metaOptions.label                            = label;
+            options.callbackOptions                              = {.callback = callback, .context = context};
+            options.buttonComboOptions.type                      = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+            options.buttonComboOptions.basicCombo.combo          = combo;
+            options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
+            return options;
+        }
+
+        ButtonComboModule_ComboOptions MakeHoldOptions(const char *label,
+                                                       const ButtonComboModule_ControllerTypes controllerMask,
+                                                       const ButtonComboModule_Buttons combo,
+                                                       const uint32_t holdDurationInMs,
+                                                       const ButtonComboModule_ComboCallback callback,
+                                                       void *context,
+                                                       const bool observer) {
+            ButtonComboModule_ComboOptions options               = {};
+            options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
+            options.metaOptions.label                            = label;
+            options.callbackOptions                              = {.callback = callback, .context = context};
+            options.buttonComboOptions.type                      = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD;
+            options.buttonComboOptions.basicCombo.combo          = combo;
+            options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
+            options.buttonComboOptions.optionalHoldForXMs        = holdDurationInMs;
+            return options;
+        }
+
+        ButtonComboModule_ComboOptions MakePressDownFilteredOptions(const char *label,
+                                                                    const ButtonComboModule_ControllerTypes controllerMask,
+                                                                    const ButtonComboModule_Buttons combo,
+                                                                    const uint32_t cooldownInMs,
+                                                                    const uint32_t debounceInMs,
+                                                                    const ButtonComboModule_ComboCallback callback,
+                                                                    void *context,
+                                                                    const bool observer) {
+            auto options          = MakePressDownOptions(label, controllerMask, combo, callback, context, observer);
+            options.version       = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX;
+            options.triggerFilter = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION, .cooldownInMs = cooldownInMs, .debounceInMs = debounceInMs};
+            return options;
+        }
+
+        ButtonComboModule_ComboOptions MakeExpressionOptions(const char *label,
+                                                             const ButtonComboModule_ControllerTypes controllerMask,
+                                                             const ButtonComboModule_ComboExpression &expression,
+                                                             const uint32_t holdDurationInMs,
+                                                             const ButtonComboModule_ComboCallback callback,
+                                                             void *context,
+                                                             const bool observer) {
+            auto options       = holdDurationInMs > 0 ? MakeHoldOptions(label, controllerMask, {}, holdDurationInMs, callback, context, observer) : MakePressDownOptions(label, controllerMask, {}, callback, context, observer);
+            options.version    = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION;
+            options.expression = expression;
+            return options;
+        }
+    } // namespace
     const char *GetStatusStr(const ButtonComboModule_Error status) {
         return ButtonComboModule_GetStatusStr(status);
     }
@@ -18,6 +87,10 @@ namespace ButtonComboModule {
         return ButtonComboModule_GetComboStatusStr(status);
     }
 
+    const char *GetConflictKindStr(const ButtonComboModule_ConflictKind kind) {
+        return ButtonComboModule_GetConflictKindStr(kind);
+    }
+
     std::optional<ButtonCombo> CreateComboEx(const ButtonComboModule_ComboOptions &options,
                                              ButtonComboModule_ComboStatus &outStatus,
                                              ButtonComboModule_Error &outError) noexcept {
@@ -32,14 +105,8 @@ namespace ButtonComboModule {
                                                       const bool observer,
                                                       ButtonComboModule_ComboStatus &outStatus,
                                                       ButtonComboModule_Error &outError) noexcept {
-        ButtonComboModule_ComboOptions options               = {};
-        options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
-        options.metaOptions.label                            = label.data();
-        options.callbackOptions                              = {.callback = callback, .context = context};
-        options.buttonComboOptions.type                      = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
-        options.buttonComboOptions.basicCombo.combo          = combo;
-        options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
-
+        const LabelString labelString(label);
+        const auto options = MakePressDownOptions(labelString.c_str(), controllerMask, combo, callback, context, observer);
         return ButtonCombo::Create(options, outStatus, outError);
     }
 
@@ -61,6 +128,35 @@ namespace ButtonComboModule {
         return CreateComboPressDownEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, callback, context, true, outStatus, outError);
     }
 
+    std::optional<ButtonCombo> CreateComboPressDownFiltered(const std::string_view label,
+                                                            const ButtonComboModule_ControllerTypes controllerMask,
+                                                            const ButtonComboModule_Buttons combo,
+                                                            const uint32_t cooldownInMs,
+                                                            const uint32_t debounceInMs,
+                                                            const ButtonComboModule_ComboCallback callback,
+                                                            void *context,
+                                                            const bool observer,
+                                                            ButtonComboModule_ComboStatus &outStatus,
+                                                            ButtonComboModule_Error &outError) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakePressDownFilteredOptions(labelString.c_str(), controllerMask, combo, cooldownInMs, debounceInMs, callback, context, observer);
+        return ButtonCombo::Create(options, outStatus, outError);
+    }
+
+    std::optional<ButtonCombo> CreateComboExpression(const std::string_view label,
+                                                     const ButtonComboModule_ControllerTypes controllerMask,
+                                                     const ButtonComboModule_ComboExpression &expression,
+                                                     const uint32_t holdDurationInMs,
+                                                     const ButtonComboModule_ComboCallback callback,
+                                                     void *context,
+                                                     const bool observer,
+                                                     ButtonComboModule_ComboStatus &outStatus,
+                                                     ButtonComboModule_Error &outError) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakeExpressionOptions(labelString.c_str(), controllerMask, expression, holdDurationInMs, callback, context, observer);
+        return ButtonCombo::Create(options, outStatus, outError);
+    }
+
 
     std::optional<ButtonCombo> CreateComboHoldEx(const std::string_view label,
                                                  const ButtonComboModule_ControllerTypes controllerMask,
@@ -71,15 +167,8 @@ namespace ButtonComboModule {
                                                  const bool observer,
                                                  ButtonComboModule_ComboStatus &outStatus,
                                                  ButtonComboModule_Error &outError) noexcept {
-        ButtonComboModule_ComboOptions options               = {};
-        options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION;
-        options.metaOptions.label                            = label.data();
-        options.callbackOptions                              = {.callback = callback, .context = context};
-        options.buttonComboOptions.type                      = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD;
-        options.buttonComboOptions.basicCombo.combo          = combo;
-        options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
-        options.buttonComboOptions.optionalHoldForXMs        = holdDurationInMs;
-
+        const LabelString labelString(label);
+        const auto options = MakeHoldOptions(labelString.c_str(), controllerMask, combo, holdDurationInMs, callback, context, observer);
         return ButtonCombo::Create(options, outStatus, outError);
     }
 
@@ -103,6 +192,98 @@ namespace ButtonComboModule {
         return CreateComboHoldEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, holdDurationInMs, callback, context, true, outStatus, outError);
     }
 
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboEx(const ButtonComboModule_ComboOptions &options,
+                                                                    ButtonComboModule_ComboStatus &outStatus) noexcept {
+        return ButtonCombo::TryCreate(options, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownEx(const std::string_view label,
+                                                                             const ButtonComboModule_ControllerTypes controllerMask,
+                                                                             const ButtonComboModule_Buttons combo,
+                                                                             const ButtonComboModule_ComboCallback callback,
+                                                                             void *context,
+                                                                             const bool observer,
+                                                                             ButtonComboModule_ComboStatus &outStatus) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakePressDownOptions(labelString.c_str(), controllerMask, combo, callback, context, observer);
+        return ButtonCombo::TryCreate(options, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDown(const std::string_view label,
+                                                                           const ButtonComboModule_Buttons combo,
+                                                                           const ButtonComboModule_ComboCallback callback,
+                                                                           void *context,
+                                                                           ButtonComboModule_ComboStatus &outStatus) noexcept {
+        return TryCreateComboPressDownEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, callback, context, false, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownObserver(const std::string_view label,
+                                                                                   const ButtonComboModule_Buttons combo,
+                                                                                   const ButtonComboModule_ComboCallback callback,
+                                                                                   void *context,
+                                                                                   ButtonComboModule_ComboStatus &outStatus) noexcept {
+        return TryCreateComboPressDownEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, callback, context, true, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboPressDownFiltered(const std::string_view label,
+                                                                                   const ButtonComboModule_ControllerTypes controllerMask,
+                                                                                   const ButtonComboModule_Buttons combo,
+                                                                                   const uint32_t cooldownInMs,
+                                                                                   const uint32_t debounceInMs,
+                                                                                   const ButtonComboModule_ComboCallback callback,
+                                                                                   void *context,
+                                                                                   const bool observer,
+                                                                                   ButtonComboModule_ComboStatus &outStatus) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakePressDownFilteredOptions(labelString.c_str(), controllerMask, combo, cooldownInMs, debounceInMs, callback, context, observer);
+        return ButtonCombo::TryCreate(options, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboExpression(const std::string_view label,
+                                                                            const ButtonComboModule_ControllerTypes controllerMask,
+                                                                            const ButtonComboModule_ComboExpression &expression,
+                                                                            const uint32_t holdDurationInMs,
+                                                                            const ButtonComboModule_ComboCallback callback,
+                                                                            void *context,
+                                                                            const bool observer,
+                                                                            ButtonComboModule_ComboStatus &outStatus) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakeExpressionOptions(labelString.c_str(), controllerMask, expression, holdDurationInMs, callback, context, observer);
+        return ButtonCombo::TryCreate(options, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHoldEx(const std::string_view label,
+                                                                        const ButtonComboModule_ControllerTypes controllerMask,
+                                                                        const ButtonComboModule_Buttons combo,
+                                                                        const uint32_t holdDurationInMs,
+                                                                        const ButtonComboModule_ComboCallback callback,
+                                                                        void *context,
+                                                                        const bool observer,
+                                                                        ButtonComboModule_ComboStatus &outStatus) noexcept {
+        const LabelString labelString(label);
+        const auto options = MakeHoldOptions(labelString.c_str(), controllerMask, combo, holdDurationInMs, callback, context, observer);
+        return ButtonCombo::TryCreate(options, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHold(const std::string_view label,
+                                                                      const ButtonComboModule_Buttons combo,
+                                                                      const uint32_t holdDurationInMs,
+                                                                      const ButtonComboModule_ComboCallback callback,
+                                                                      void *context,
+                                                                      ButtonComboModule_ComboStatus &outStatus) noexcept {
+        return TryCreateComboHoldEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, holdDurationInMs, callback, context, false, outStatus);
+    }
+
+    expected<ButtonCombo, ButtonComboModule_Error> TryCreateComboHoldObserver(const std::string_view label,
+                                                                              const ButtonComboModule_Buttons combo,
+                                                                              const uint32_t holdDurationInMs,
+                                                                              const ButtonComboModule_ComboCallback callback,
+                                                                              void *context,
+                                                                              ButtonComboModule_ComboStatus &outStatus) noexcept {
+        return TryCreateComboHoldEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, holdDurationInMs, callback, context, true, outStatus);
+    }
+
+#ifndef BUTTONCOMBO_NO_EXCEPTIONS
     ButtonCombo CreateComboEx(const ButtonComboModule_ComboOptions &options,
                               ButtonComboModule_ComboStatus &outStatus) {
         return ButtonCombo::Create(options, outStatus);
@@ -139,6 +320,39 @@ namespace ButtonComboModule {
         return CreateComboPressDownEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, callback, context, true, outStatus);
     }
 
+    ButtonCombo CreateComboPressDownFiltered(const std::string_view label,
+                                             const ButtonComboModule_ControllerTypes controllerMask,
+                                             const ButtonComboModule_Buttons combo,
+                                             const uint32_t cooldownInMs,
+                                             const uint32_t debounceInMs,
+                                             const ButtonComboModule_ComboCallback callback,
+                                             void *context,
+                                             const bool observer,
+                                             ButtonComboModule_ComboStatus &outStatus) {
+        ButtonComboModule_Error error;
+        auto res = CreateComboPressDownFiltered(label, controllerMask, combo, cooldownInMs, debounceInMs, callback, context, observer, outStatus, error);
+        if (!res) {
+            throw std::runtime_error{std::string("Failed to create press down filtered button combo: ").append(ButtonComboModule_GetStatusStr(error))};
+        }
+        return std::move(*res);
+    }
+
+    ButtonCombo CreateComboExpression(const std::string_view label,
+                                      const ButtonComboModule_ControllerTypes controllerMask,
+                                      const ButtonComboModule_ComboExpression &expression,
+                                      const uint32_t holdDurationInMs,
+                                      const ButtonComboModule_ComboCallback callback,
+                                      void *context,
+                                      const bool observer,
+                                      ButtonComboModule_ComboStatus &outStatus) {
+        ButtonComboModule_Error error;
+        auto res = CreateComboExpression(label, controllerMask, expression, holdDurationInMs, callback, context, observer, outStatus, error);
+        if (!res) {
+            throw std::runtime_error{std::string("Failed to create expression button combo: ").append(ButtonComboModule_GetStatusStr(error))};
+        }
+        return std::move(*res);
+    }
+
     ButtonCombo CreateComboHoldEx(const std::string_view label,
                                   const ButtonComboModule_ControllerTypes controllerMask,
                                   const ButtonComboModule_Buttons combo,
@@ -173,13 +387,81 @@ namespace ButtonComboModule {
         return CreateComboHoldEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, holdDurationInMs, callback, context, true, outStatus);
     }
 
+#endif
+
     ButtonComboModule_Error CheckComboAvailable(const ButtonComboModule_ButtonComboOptions &options,
                                                 ButtonComboModule_ComboStatus &outStatus) {
         return ButtonComboModule_CheckComboAvailable(&options, &outStatus);
     }
 
+    ButtonComboModule_Error SuggestFreeCombos(const ButtonComboModule_SuggestComboOptions &options,
+                                              const std::span<ButtonComboModule_Buttons> outCombos,
+                                              uint32_t &outCount) {
+        return ButtonComboModule_SuggestFreeCombos(&options, outCombos.data(), static_cast<uint32_t>(outCombos.size()), &outCount);
+    }
+
+    ButtonComboModule_Error GetComboSnapshot(const std::span<uint32_t> buffer,
+                                             uint32_t &outRequiredSize) {
+        return ButtonComboModule_GetComboSnapshot(buffer.data(), static_cast<uint32_t>(buffer.size_bytes()), &outRequiredSize);
+    }
+
+    ButtonComboModule_Error GetControllerStates(const ButtonComboModule_ControllerTypes controllerMask,
+                                                ControllerStates &outStates) {
+        uint32_t count = 0;
+        outStates.resize(outStates.capacity());
+        const auto res = ButtonComboModule_GetControllerStates(controllerMask, outStates.data(), static_cast<uint32_t>(outStates.capacity()), &count);
+        outStates.resize(res == BUTTON_COMBO_MODULE_ERROR_SUCCESS ? count : 0);
+        return res;
+    }
+
     ButtonComboModule_Error DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions &options,
                                                        ButtonComboModule_Buttons &outButtons) {
         return ButtonComboModule_DetectButtonCombo_Blocking(&options, &outButtons);
     }
+
+    ButtonComboModule_Error SetBatchCallback(const ButtonComboModule_BatchCallback callback,
+                                             void *context) {
+        return ButtonComboModule_SetBatchCallback(callback, context);
+    }
+
+    ButtonComboModule_Error GetStats(ButtonComboModule_Stats &outStats) {
+        outStats         = {};
+        outStats.version = BUTTON_COMBO_MODULE_STATS_VERSION;
+        return ButtonComboModule_GetStats(&outStats);
+    }
+
+    uint32_t FormatStats(const ButtonComboModule_Stats &stats, const std::span<char> outBuffer) {
+        static constexpr const char *TYPE_NAMES[BUTTON_COMBO_MODULE_COMBO_TYPE_COUNT]       = {"invalid", "hold", "hold observer", "press down", "press down observer"};
+        static constexpr const char *CONTROLLER_NAMES[BUTTON_COMBO_MODULE_CONTROLLER_COUNT] = {"VPAD_0", "VPAD_1", "WPAD_0", "WPAD_1", "WPAD_2", "WPAD_3", "WPAD_4", "WPAD_5", "WPAD_6"};
+
+        uint32_t length = 0;
+        // Keeps counting the required length once the buffer is full.
+        auto append = [&](const char *fmt, auto... args) {
+            const size_t offset = std::min<size_t>(length, outBuffer.size());
+            const int res       = snprintf(outBuffer.data() + offset, outBuffer.size() - offset, fmt, args...);
+            if (res > 0) {
+                length += static_cast<uint32_t>(res);
+            }
+        };
+
+        uint32_t total = 0;
+        for (const auto count : stats.combosByType) {
+            total += count;
+        }
+        append("Combos: %" PRIu32 " (", total);
+        for (uint32_t i = 1; i < BUTTON_COMBO_MODULE_COMBO_TYPE_COUNT; i++) {
+            append("%s%s: %" PRIu32, i > 1 ? ", " : "", TYPE_NAMES[i], stats.combosByType[i]);
+        }
+        append(")\nPer controller:");
+        for (uint32_t i = 0; i < BUTTON_COMBO_MODULE_CONTROLLER_COUNT; i++) {
+            append(" %s: %" PRIu32, CONTROLLER_NAMES[i], stats.combosByController[i]);
+        }
+        append("\nMemory: %" PRIu32 " bytes combos, %" PRIu32 " bytes labels\n", stats.comboMemoryInBytes, stats.labelMemoryInBytes);
+        append("Frame evaluation: avg %" PRIu32 " us, peak %" PRIu32 " us\n", stats.avgFrameEvalTimeInUs, stats.peakFrameEvalTimeInUs);
+        append("Callbacks: %" PRIu64 " dispatched, %" PRIu64 " over budget (%" PRIu32 " us)",
+               stats.callbacksDispatched,
+               stats.callbacksOverBudget,
+               stats.callbackBudgetInUs);
+        return length;
+    }
 } // namespace ButtonComboModule
\ No newline at end of file
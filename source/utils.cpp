@@ -1,32 +1,30 @@
+// The library always provides the out-of-line definitions of the wrappers.
+#undef BUTTONCOMBO_INLINE
+
+#include "CallbackRedirect.h"
+#include "ComboRegistry.h"
 #include "logger.h"
 #include <buttoncombo/api.h>
+#include <buttoncombo/api_inline.h>
 #include <buttoncombo/defines.h>
+#include <buttoncombo/dispatch.h>
 #include <coreinit/debug.h>
 #include <coreinit/dynload.h>
-#include <cstdarg>
+#include <coreinit/thread.h>
 
-static OSDynLoad_Module sModuleHandle = nullptr;
+#include <atomic>
+#include <cstdarg>
 
-static ButtonComboModule_Error (*sBCMGetVersionFn)(ButtonComboModule_APIVersion *) = nullptr;
+// Bit 31 is set while the library is being (de)initialized, the lower bits hold the reference count.
+static constexpr uint32_t LIB_STATE_BUSY = 0x80000000;
 
-static ButtonComboModule_Error (*sBCMAddButtonComboFn)(const ButtonComboModule_ComboOptions *options, ButtonComboModule_ComboHandle *outHandle, ButtonComboModule_ComboStatus *outStatus)    = nullptr;
-static ButtonComboModule_Error (*sBCMRemoveButtonComboFn)(ButtonComboModule_ComboHandle handle)                                                                                              = nullptr;
-static ButtonComboModule_Error (*sBCMGetButtonComboStatus)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ComboStatus *outStatus)                                                   = nullptr;
-static ButtonComboModule_Error (*sBCMUpdateButtonComboMeta)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_MetaOptions *options)                                              = nullptr;
-static ButtonComboModule_Error (*sBCMUpdateButtonComboCallback)(ButtonComboModule_ComboHandle handle, const ButtonComboModule_CallbackOptions *options)                                      = nullptr;
-static ButtonComboModule_Error (*sBCMUpdateControllerMask)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ControllerTypes controllerMask, ButtonComboModule_ComboStatus *outStatus) = nullptr;
-static ButtonComboModule_Error (*sBCMUpdateButtonCombo)(ButtonComboModule_ComboHandle handle, ButtonComboModule_Buttons combo, ButtonComboModule_ComboStatus *outStatus)                     = nullptr;
-static ButtonComboModule_Error (*sBCMUpdateHoldDuration)(ButtonComboModule_ComboHandle handle, uint32_t holdDurationInMs)                                                                    = nullptr;
-static ButtonComboModule_Error (*sBCMGetButtonComboMeta)(ButtonComboModule_ComboHandle handle, ButtonComboModule_MetaOptionsOut *outOptions)                                                 = nullptr;
-static ButtonComboModule_Error (*sBCMGetButtonComboCallback)(ButtonComboModule_ComboHandle handle, ButtonComboModule_CallbackOptions *outOptions)                                            = nullptr;
-static ButtonComboModule_Error (*sBCMGetButtonComboInfoEx)(ButtonComboModule_ComboHandle handle, ButtonComboModule_ButtonComboInfoEx *outOptions)                                            = nullptr;
+static std::atomic<uint32_t> sLibState = 0;
 
-static ButtonComboModule_Error (*sBCMCheckComboAvailable)(const ButtonComboModule_ButtonComboOptions *options, ButtonComboModule_ComboStatus *outStatus)              = nullptr;
-static ButtonComboModule_Error (*sBCMDetectButtonComboBlocking)(const ButtonComboModule_DetectButtonComboOptions *options, ButtonComboModule_Buttons *outButtonCombo) = nullptr;
+static OSDynLoad_Module sModuleHandle = nullptr;
 
-static bool sLibInitDone = false;
+static ButtonComboModule_DispatchTable sDispatchTable = {.version = BUTTON_COMBO_MODULE_API_VERSION_ERROR};
 
-static ButtonComboModule_APIVersion sButtonComboModuleVersion = BUTTON_COMBO_MODULE_API_VERSION_ERROR;
+const ButtonComboModule_DispatchTable *gButtonComboModuleDispatch = nullptr;
 
 const char *ButtonComboModule_GetStatusStr(const ButtonComboModule_Error status) {
     switch (status) {
@@ -58,6 +56,8 @@ const char *ButtonComboModule_GetStatusStr(const ButtonComboModule_Error status)
             return "BUTTON_COMBO_MODULE_ERROR_HANDLE_NOT_FOUND";
         case BUTTON_COMBO_MODULE_ERROR_ABORTED:
             return "BUTTON_COMBO_MODULE_ERROR_ABORTED";
+        case BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL:
+            return "BUTTON_COMBO_MODULE_ERROR_BUFFER_TOO_SMALL";
     }
     return "BUTTON_COMBO_MODULE_ERROR_UNKNOWN_ERROR";
 }
@@ -95,133 +95,466 @@ const char *ButtonComboModule_GetComboStatusStr(ButtonComboModule_ComboStatus st
             return "BUTTON_COMBO_MODULE_COMBO_STATUS_VALID";
         case BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT:
             return "BUTTON_COMBO_MODULE_COMBO_STATUS_CONFLICT";
+        case BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED:
+            return "BUTTON_COMBO_MODULE_COMBO_STATUS_DISABLED";
     }
     return "BUTTON_COMBO_MODULE_COMBO_STATUS_INVALID_STATUS";
 }
 
-ButtonComboModule_Error ButtonComboModule_InitLibrary() {
-    if (sLibInitDone) {
-        return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+const char *ButtonComboModule_GetConflictKindStr(const ButtonComboModule_ConflictKind kind) {
+    switch (kind) {
+        case BUTTON_COMBO_MODULE_CONFLICT_KIND_IDENTICAL:
+            return "BUTTON_COMBO_MODULE_CONFLICT_KIND_IDENTICAL";
+        case BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET:
+            return "BUTTON_COMBO_MODULE_CONFLICT_KIND_SUBSET";
+        case BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET:
+            return "BUTTON_COMBO_MODULE_CONFLICT_KIND_SUPERSET";
+        case BUTTON_COMBO_MODULE_CONFLICT_KIND_OVERLAP:
+            return "BUTTON_COMBO_MODULE_CONFLICT_KIND_OVERLAP";
+    }
+    return "<UNKNOWN CONFLICT KIND>";
+}
+
+static constexpr ButtonComboModule_StickDirectionOptions DEFAULT_STICK_DIRECTION_OPTIONS = {.deadzone   = BUTTON_COMBO_MODULE_STICK_DEADZONE_DEFAULT,
+                                                                                          .hysteresis = BUTTON_COMBO_MODULE_STICK_HYSTERESIS_DEFAULT};
+
+static uint32_t GetStickAxisButtons(const ButtonComboModule_StickDirectionOptions &options,
+                                     const float value,
+                                     const uint32_t previous,
+                                     const uint32_t negativeButton,
+                                     const uint32_t positiveButton) {
+    const float releaseThreshold = options.deadzone - options.hysteresis;
+    uint32_t buttons             = 0;
+    if (value >= options.deadzone || ((previous & positiveButton) != 0 && value >= releaseThreshold)) {
+        buttons |= positiveButton;
+    } else if (value <= -options.deadzone || ((previous & negativeButton) != 0 && value <= -releaseThreshold)) {
+        buttons |= negativeButton;
+    }
+    return buttons;
+}
+
+ButtonComboModule_Buttons ButtonComboModule_GetStickDirectionButtons(const ButtonComboModule_StickDirectionOptions *options,
+                                                                     const float leftX,
+                                                                     const float leftY,
+                                                                     const float rightX,
+                                                                     const float rightY,
+                                                                     const ButtonComboModule_Buttons previous) {
+    const auto &opts = options != nullptr ? *options : DEFAULT_STICK_DIRECTION_OPTIONS;
+
+    uint32_t buttons = 0;
+    buttons |= GetStickAxisButtons(opts, leftX, previous, BCMPAD_BUTTON_STICK_L_LEFT, BCMPAD_BUTTON_STICK_L_RIGHT);
+    buttons |= GetStickAxisButtons(opts, leftY, previous, BCMPAD_BUTTON_STICK_L_DOWN, BCMPAD_BUTTON_STICK_L_UP);
+    buttons |= GetStickAxisButtons(opts, rightX, previous, BCMPAD_BUTTON_STICK_R_LEFT, BCMPAD_BUTTON_STICK_R_RIGHT);
+    buttons |= GetStickAxisButtons(opts, rightY, previous, BCMPAD_BUTTON_STICK_R_DOWN, BCMPAD_BUTTON_STICK_R_UP);
+    return static_cast<ButtonComboModule_Buttons>(buttons);
+}
+
+void ButtonComboModule_DispatchTriggerRecords(const ButtonComboModule_TriggerRecord *records, const uint32_t count, void *) {
+    for (uint32_t i = 0; i < count; i++) {
+        const auto &record = records[i];
+        if (record.callbackOptions.callback != nullptr) {
+            record.callbackOptions.callback(record.triggeredBy, record.handle, record.callbackOptions.context);
+        }
     }
-    if (OSDynLoad_Acquire("homebrew_buttoncombo", &sModuleHandle) != OS_DYNLOAD_OK) {
-        DEBUG_FUNCTION_LINE_ERR("OSDynLoad_Acquire failed.");
-        return BUTTON_COMBO_MODULE_ERROR_MODULE_NOT_FOUND;
+}
+
+static void ExecutorTrampoline(const ButtonComboModule_ControllerTypes triggeredBy, const ButtonComboModule_ComboHandle handle, void *context) {
+    auto *binding = static_cast<ButtonComboModule_ExecutorBinding *>(context);
+    __atomic_add_fetch(&binding->inFlight, 1, __ATOMIC_SEQ_CST);
+    const ButtonComboModule_TriggerRecord record = {.handle = handle, .triggeredBy = triggeredBy, .callbackOptions = binding->callbackOptions};
+    if (!binding->executor.post(binding->executor.userData, &record)) {
+        __atomic_add_fetch(&binding->droppedCount, 1, __ATOMIC_RELAXED);
+    }
+    // Last access to the binding by this trigger.
+    __atomic_sub_fetch(&binding->inFlight, 1, __ATOMIC_SEQ_CST);
+}
+
+ButtonComboModule_Error ButtonComboModule_BindExecutor(const ButtonComboModule_ComboHandle handle,
+                                                       const ButtonComboModule_Executor *executor,
+                                                       ButtonComboModule_ExecutorBinding *outBinding) {
+    if (handle == nullptr || executor == nullptr || executor->post == nullptr || outBinding == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    outBinding->handle       = handle;
+    outBinding->executor     = *executor;
+    outBinding->droppedCount = 0;
+    outBinding->inFlight     = 0;
+    if (const auto res = ButtonComboModule::GetRedirectableCallback(handle, outBinding->callbackOptions); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        return res;
+    }
+
+    const ButtonComboModule_CallbackOptions options = {.callback = ExecutorTrampoline, .context = outBinding};
+    return ButtonComboModule_UpdateButtonComboCallback(handle, &options);
+}
+
+ButtonComboModule_Error ButtonComboModule_UnbindExecutor(ButtonComboModule_ExecutorBinding *binding) {
+    if (binding == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    const auto res = ButtonComboModule_UpdateButtonComboCallback(binding->handle, &binding->callbackOptions);
+    if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        // A trigger that has been dispatched before the callback was restored may still be posting.
+        while (__atomic_load_n(&binding->inFlight, __ATOMIC_SEQ_CST) != 0) {
+            OSYieldThread();
+        }
+    }
+    return res;
+}
+
+static void CallbackSlotTrampoline(const ButtonComboModule_ControllerTypes triggeredBy, const ButtonComboModule_ComboHandle handle, void *context) {
+    auto *slot = static_cast<ButtonComboModule_CallbackSlot *>(context);
+    uint32_t index;
+    while (true) {
+        index = __atomic_load_n(&slot->active, __ATOMIC_SEQ_CST);
+        __atomic_add_fetch(&slot->readers[index], 1, __ATOMIC_SEQ_CST);
+        // Only retries if a swap has been published in between.
+        if (__atomic_load_n(&slot->active, __ATOMIC_SEQ_CST) == index) {
+            break;
+        }
+        __atomic_sub_fetch(&slot->readers[index], 1, __ATOMIC_SEQ_CST);
+    }
+    const auto &options = slot->callbackOptions[index];
+    if (options.callback != nullptr) {
+        options.callback(triggeredBy, handle, options.context);
+    }
+    __atomic_sub_fetch(&slot->readers[index], 1, __ATOMIC_SEQ_CST);
+}
+
+static void LockCallbackSlot(ButtonComboModule_CallbackSlot *slot) {
+    uint32_t expected = 0;
+    while (!__atomic_compare_exchange_n(&slot->writerLock, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        expected = 0;
+        OSYieldThread();
+    }
+}
+
+static void UnlockCallbackSlot(ButtonComboModule_CallbackSlot *slot) {
+    __atomic_store_n(&slot->writerLock, 0, __ATOMIC_RELEASE);
+}
+
+static void WaitForCallbackSlotReaders(ButtonComboModule_CallbackSlot *slot, const uint32_t index) {
+    while (__atomic_load_n(&slot->readers[index], __ATOMIC_SEQ_CST) != 0) {
+        OSYieldThread();
     }
+}
 
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetVersion", reinterpret_cast<void **>(&sBCMGetVersionFn)) != OS_DYNLOAD_OK) {
+ButtonComboModule_Error ButtonComboModule_InstallCallbackSlot(const ButtonComboModule_ComboHandle handle,
+                                                              ButtonComboModule_CallbackSlot *outSlot) {
+    if (handle == nullptr || outSlot == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    *outSlot        = {};
+    outSlot->handle = handle;
+    if (const auto res = ButtonComboModule::GetRedirectableCallback(handle, outSlot->callbackOptions[0]); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        return res;
+    }
+
+    const ButtonComboModule_CallbackOptions options = {.callback = CallbackSlotTrampoline, .context = outSlot};
+    return ButtonComboModule_UpdateButtonComboCallback(handle, &options);
+}
+
+ButtonComboModule_Error ButtonComboModule_SwapCallback(ButtonComboModule_CallbackSlot *slot,
+                                                       const ButtonComboModule_CallbackOptions *callbackOptions,
+                                                       ButtonComboModule_CallbackOptions *outOldOptions) {
+    if (slot == nullptr || callbackOptions == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    LockCallbackSlot(slot);
+    const uint32_t current = __atomic_load_n(&slot->active, __ATOMIC_RELAXED);
+    const uint32_t next    = current ^ 1;
+    // Dispatches that lost the race against the previous swap may still hold a reference to the unused pair.
+    WaitForCallbackSlotReaders(slot, next);
+    slot->callbackOptions[next] = *callbackOptions;
+    __atomic_store_n(&slot->active, next, __ATOMIC_SEQ_CST);
+    WaitForCallbackSlotReaders(slot, current);
+    if (outOldOptions != nullptr) {
+        *outOldOptions = slot->callbackOptions[current];
+    }
+    UnlockCallbackSlot(slot);
+    return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+}
+
+ButtonComboModule_Error ButtonComboModule_UninstallCallbackSlot(ButtonComboModule_CallbackSlot *slot) {
+    if (slot == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    LockCallbackSlot(slot);
+    const auto res = ButtonComboModule_UpdateButtonComboCallback(slot->handle, &slot->callbackOptions[__atomic_load_n(&slot->active, __ATOMIC_RELAXED)]);
+    if (res == BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        WaitForCallbackSlotReaders(slot, 0);
+        WaitForCallbackSlotReaders(slot, 1);
+    }
+    UnlockCallbackSlot(slot);
+    return res;
+}
+
+static ButtonComboModule_Error LoadModuleExports(const OSDynLoad_Module module, ButtonComboModule_DispatchTable &table) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetVersion", reinterpret_cast<void **>(&table.getVersion)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_GetVersion failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_AddButtonCombo", reinterpret_cast<void **>(&sBCMAddButtonComboFn)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_AddButtonCombo", reinterpret_cast<void **>(&table.addButtonCombo)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_AddButtonCombo failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_RemoveButtonCombo", reinterpret_cast<void **>(&sBCMRemoveButtonComboFn)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_RemoveButtonCombo", reinterpret_cast<void **>(&table.removeButtonCombo)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_RemoveButtonCombo failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboStatus", reinterpret_cast<void **>(&sBCMGetButtonComboStatus)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboStatus", reinterpret_cast<void **>(&table.getButtonComboStatus)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_GetButtonComboStatus failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonComboMeta", reinterpret_cast<void **>(&sBCMUpdateButtonComboMeta)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonComboMeta", reinterpret_cast<void **>(&table.updateButtonComboMeta)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_UpdateButtonComboMeta failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonComboCallback", reinterpret_cast<void **>(&sBCMUpdateButtonComboCallback)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonComboCallback", reinterpret_cast<void **>(&table.updateButtonComboCallback)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_UpdateButtonComboCallback failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateControllerMask", reinterpret_cast<void **>(&sBCMUpdateControllerMask)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateControllerMask", reinterpret_cast<void **>(&table.updateControllerMask)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_UpdateControllerMask failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonCombo", reinterpret_cast<void **>(&sBCMUpdateButtonCombo)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateButtonCombo", reinterpret_cast<void **>(&table.updateButtonCombo)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_UpdateButtonCombo failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateHoldDuration", reinterpret_cast<void **>(&sBCMUpdateHoldDuration)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateHoldDuration", reinterpret_cast<void **>(&table.updateHoldDuration)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_UpdateHoldDuration failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboMeta", reinterpret_cast<void **>(&sBCMGetButtonComboMeta)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboMeta", reinterpret_cast<void **>(&table.getButtonComboMeta)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_GetButtonComboMeta failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboCallback", reinterpret_cast<void **>(&sBCMGetButtonComboCallback)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboCallback", reinterpret_cast<void **>(&table.getButtonComboCallback)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_GetButtonComboCallback failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboInfoEx", reinterpret_cast<void **>(&sBCMGetButtonComboInfoEx)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboInfoEx", reinterpret_cast<void **>(&table.getButtonComboInfoEx)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_GetButtonComboInfoEx failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_CheckComboAvailable", reinterpret_cast<void **>(&sBCMCheckComboAvailable)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_CheckComboAvailable", reinterpret_cast<void **>(&table.checkComboAvailable)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_CheckComboAvailable failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
-    if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_DetectButtonCombo_Blocking", reinterpret_cast<void **>(&sBCMDetectButtonComboBlocking)) != OS_DYNLOAD_OK) {
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_DetectButtonCombo_Blocking", reinterpret_cast<void **>(&table.detectButtonComboBlocking)) != OS_DYNLOAD_OK) {
         DEBUG_FUNCTION_LINE_ERR("FindExport ButtonComboModule_DetectButtonCombo_Blocking failed.");
         return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
 
-    if (ButtonComboModule_GetVersion(&sButtonComboModuleVersion) != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
-        sButtonComboModuleVersion = BUTTON_COMBO_MODULE_API_VERSION_ERROR;
+    // The following exports are optional, older modules don't provide them.
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_DetectButtonCombo_Async", reinterpret_cast<void **>(&table.detectButtonComboAsync)) != OS_DYNLOAD_OK) {
+        table.detectButtonComboAsync = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_RemoveButtonCombos", reinterpret_cast<void **>(&table.removeButtonCombos)) != OS_DYNLOAD_OK) {
+        table.removeButtonCombos = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetBatchCallback", reinterpret_cast<void **>(&table.setBatchCallback)) != OS_DYNLOAD_OK) {
+        table.setBatchCallback = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateTriggerFilter", reinterpret_cast<void **>(&table.updateTriggerFilter)) != OS_DYNLOAD_OK) {
+        table.updateTriggerFilter = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetSuppressedTriggerCount", reinterpret_cast<void **>(&table.getSuppressedTriggerCount)) != OS_DYNLOAD_OK) {
+        table.getSuppressedTriggerCount = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SuggestFreeCombos", reinterpret_cast<void **>(&table.suggestFreeCombos)) != OS_DYNLOAD_OK) {
+        table.suggestFreeCombos = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetComboSnapshot", reinterpret_cast<void **>(&table.getComboSnapshot)) != OS_DYNLOAD_OK) {
+        table.getComboSnapshot = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetStats", reinterpret_cast<void **>(&table.getStats)) != OS_DYNLOAD_OK) {
+        table.getStats = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetCallbackBudget", reinterpret_cast<void **>(&table.setCallbackBudget)) != OS_DYNLOAD_OK) {
+        table.setCallbackBudget = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_CreateComboGroup", reinterpret_cast<void **>(&table.createComboGroup)) != OS_DYNLOAD_OK) {
+        table.createComboGroup = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_DestroyComboGroup", reinterpret_cast<void **>(&table.destroyComboGroup)) != OS_DYNLOAD_OK) {
+        table.destroyComboGroup = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_AddToComboGroup", reinterpret_cast<void **>(&table.addToComboGroup)) != OS_DYNLOAD_OK) {
+        table.addToComboGroup = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_RemoveFromComboGroup", reinterpret_cast<void **>(&table.removeFromComboGroup)) != OS_DYNLOAD_OK) {
+        table.removeFromComboGroup = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetComboGroupEnabled", reinterpret_cast<void **>(&table.setComboGroupEnabled)) != OS_DYNLOAD_OK) {
+        table.setComboGroupEnabled = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateComboExpression", reinterpret_cast<void **>(&table.updateComboExpression)) != OS_DYNLOAD_OK) {
+        table.updateComboExpression = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetComboExpression", reinterpret_cast<void **>(&table.getComboExpression)) != OS_DYNLOAD_OK) {
+        table.getComboExpression = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetComboConflicts", reinterpret_cast<void **>(&table.getComboConflicts)) != OS_DYNLOAD_OK) {
+        table.getComboConflicts = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboConflicts", reinterpret_cast<void **>(&table.getButtonComboConflicts)) != OS_DYNLOAD_OK) {
+        table.getButtonComboConflicts = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboLabel", reinterpret_cast<void **>(&table.getButtonComboLabel)) != OS_DYNLOAD_OK) {
+        table.getButtonComboLabel = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_UpdateStickDirectionOptions", reinterpret_cast<void **>(&table.updateStickDirectionOptions)) != OS_DYNLOAD_OK) {
+        table.updateStickDirectionOptions = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetControllerStates", reinterpret_cast<void **>(&table.getControllerStates)) != OS_DYNLOAD_OK) {
+        table.getControllerStates = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_InjectInput", reinterpret_cast<void **>(&table.injectInput)) != OS_DYNLOAD_OK) {
+        table.injectInput = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetRealInputMask", reinterpret_cast<void **>(&table.setRealInputMask)) != OS_DYNLOAD_OK) {
+        table.setRealInputMask = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_StartTimelineRecording", reinterpret_cast<void **>(&table.startTimelineRecording)) != OS_DYNLOAD_OK) {
+        table.startTimelineRecording = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_StopTimelineRecording", reinterpret_cast<void **>(&table.stopTimelineRecording)) != OS_DYNLOAD_OK) {
+        table.stopTimelineRecording = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetButtonComboCallbackEx", reinterpret_cast<void **>(&table.getButtonComboCallbackEx)) != OS_DYNLOAD_OK) {
+        table.getButtonComboCallbackEx = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetClientSuspended", reinterpret_cast<void **>(&table.setClientSuspended)) != OS_DYNLOAD_OK) {
+        table.setClientSuspended = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_SetButtonComboSuspendExempt", reinterpret_cast<void **>(&table.setButtonComboSuspendExempt)) != OS_DYNLOAD_OK) {
+        table.setButtonComboSuspendExempt = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetRealInputMask", reinterpret_cast<void **>(&table.getRealInputMask)) != OS_DYNLOAD_OK) {
+        table.getRealInputMask = nullptr;
+    }
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "ButtonComboModule_GetTriggerFilter", reinterpret_cast<void **>(&table.getTriggerFilter)) != OS_DYNLOAD_OK) {
+        table.getTriggerFilter = nullptr;
+    }
+
+    if (table.getVersion(&table.version) != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
+        table.version = BUTTON_COMBO_MODULE_API_VERSION_ERROR;
         return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_API_VERSION;
     }
 
-    sLibInitDone = true;
     return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
 }
 
-ButtonComboModule_Error ButtonComboModule_DeInitLibrary() {
-    if (sLibInitDone) {
-        sBCMGetVersionFn          = nullptr;
-        sButtonComboModuleVersion = BUTTON_COMBO_MODULE_API_VERSION_ERROR;
+ButtonComboModule_Error ButtonComboModule_InitLibrary() {
+    uint32_t state = sLibState.load(std::memory_order_acquire);
+    while (true) {
+        if (state & LIB_STATE_BUSY) {
+            // Another thread is currently (de)initializing the library.
+            OSYieldThread();
+            state = sLibState.load(std::memory_order_acquire);
+            continue;
+        }
+        if (state != 0) {
+            // Already initialized, just take another reference.
+            if (sLibState.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+            }
+            continue;
+        }
+        if (sLibState.compare_exchange_weak(state, LIB_STATE_BUSY, std::memory_order_acquire, std::memory_order_acquire)) {
+            break;
+        }
+    }
+
+    // This thread is now the only one that touches the module handle and dispatch table. The table is never zeroed, a
+    // thread that loaded the pointer before the last DeInit may still read it. LoadModuleExports overwrites every entry.
+    if (OSDynLoad_Acquire("homebrew_buttoncombo", &sModuleHandle) != OS_DYNLOAD_OK) {
+        DEBUG_FUNCTION_LINE_ERR("OSDynLoad_Acquire failed.");
+        sModuleHandle = nullptr;
+        sLibState.store(0, std::memory_order_release);
+        return BUTTON_COMBO_MODULE_ERROR_MODULE_NOT_FOUND;
+    }
+
+    if (const auto res = LoadModuleExports(sModuleHandle, sDispatchTable); res != BUTTON_COMBO_MODULE_ERROR_SUCCESS) {
         OSDynLoad_Release(sModuleHandle);
         sModuleHandle = nullptr;
-        sLibInitDone  = false;
+        sLibState.store(0, std::memory_order_release);
+        return res;
     }
+
+    __atomic_store_n(&gButtonComboModuleDispatch, &sDispatchTable, __ATOMIC_RELEASE);
+    sLibState.store(1, std::memory_order_release);
     return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
 }
 
-ButtonComboModule_Error ButtonComboModule_GetVersion(ButtonComboModule_APIVersion *outVersion) {
-    if (sBCMGetVersionFn == nullptr) {
-        if (OSDynLoad_Acquire("homebrew_buttoncombo", &sModuleHandle) != OS_DYNLOAD_OK) {
-            DEBUG_FUNCTION_LINE_WARN("OSDynLoad_Acquire failed.");
-            return BUTTON_COMBO_MODULE_ERROR_MODULE_NOT_FOUND;
+ButtonComboModule_Error ButtonComboModule_DeInitLibrary() {
+    uint32_t state = sLibState.load(std::memory_order_acquire);
+    while (true) {
+        if (state & LIB_STATE_BUSY) {
+            OSYieldThread();
+            state = sLibState.load(std::memory_order_acquire);
+            continue;
         }
-
-        if (OSDynLoad_FindExport(sModuleHandle, OS_DYNLOAD_EXPORT_FUNC, "GetVersion", reinterpret_cast<void **>(&sBCMGetVersionFn)) != OS_DYNLOAD_OK) {
-            DEBUG_FUNCTION_LINE_WARN("FindExport sBCMGetVersion failed.");
-            return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
+        if (state == 0) {
+            // Not initialized
+            return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+        }
+        if (state > 1) {
+            // Drop a reference, someone else is still using the library.
+            if (sLibState.compare_exchange_weak(state, state - 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
+            }
+            continue;
+        }
+        if (sLibState.compare_exchange_weak(state, LIB_STATE_BUSY, std::memory_order_acquire, std::memory_order_acquire)) {
+            break;
         }
     }
 
-    return sBCMGetVersionFn(outVersion);
+    // Last reference, release all combos that are still owned by ButtonCombo objects and resume the remaining ones.
+    ButtonComboModule::ComboRegistry::ReleaseAll();
+    ButtonComboModule_SetForegroundLifecycleEnabled(false);
+    // The recorder is owned by the app, make sure the module doesn't write to it anymore.
+    ButtonComboModule_StopTimelineRecording();
+
+    // Unpublish the exports before releasing the module. The table itself is left intact, a wrapper that loaded the
+    // pointer just before must not end up calling through a zeroed entry.
+    __atomic_store_n(&gButtonComboModuleDispatch, nullptr, __ATOMIC_RELEASE);
+    OSDynLoad_Release(sModuleHandle);
+    sModuleHandle = nullptr;
+
+    sLibState.store(0, std::memory_order_release);
+    return BUTTON_COMBO_MODULE_ERROR_SUCCESS;
 }
 
-ButtonComboModule_Error ButtonComboModule_AddButtonCombo(const ButtonComboModule_ComboOptions *options,
-                                                         ButtonComboModule_ComboHandle *outHandle,
-                                                         ButtonComboModule_ComboStatus *outStatus) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
+ButtonComboModule_Error ButtonComboModule_GetVersion(ButtonComboModule_APIVersion *outVersion) {
+    if (outVersion == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
     }
-    if (sBCMAddButtonComboFn == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
+    if (const auto *table = __atomic_load_n(&gButtonComboModuleDispatch, __ATOMIC_ACQUIRE); table != nullptr) {
+        return table->getVersion(outVersion);
     }
 
-    if (options == nullptr || outHandle == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    // The library is not initialized, query the module directly.
+    OSDynLoad_Module module;
+    if (OSDynLoad_Acquire("homebrew_buttoncombo", &module) != OS_DYNLOAD_OK) {
+        DEBUG_FUNCTION_LINE_WARN("OSDynLoad_Acquire failed.");
+        return BUTTON_COMBO_MODULE_ERROR_MODULE_NOT_FOUND;
     }
-    if (options->version != BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION) {
-        return BUTTON_COMBO_MODULE_ERROR_INCOMPATIBLE_OPTIONS_VERSION;
+
+    ButtonComboModule_Error (*getVersionFn)(ButtonComboModule_APIVersion *) = nullptr;
+    if (OSDynLoad_FindExport(module, OS_DYNLOAD_EXPORT_FUNC, "GetVersion", reinterpret_cast<void **>(&getVersionFn)) != OS_DYNLOAD_OK) {
+        DEBUG_FUNCTION_LINE_WARN("FindExport GetVersion failed.");
+        OSDynLoad_Release(module);
+        return BUTTON_COMBO_MODULE_ERROR_MODULE_MISSING_EXPORT;
     }
 
-    return sBCMAddButtonComboFn(options, outHandle, outStatus);
+    const auto res = getVersionFn(outVersion);
+    OSDynLoad_Release(module);
+    return res;
 }
 
-
 ButtonComboModule_Error ButtonComboModule_AddButtonComboPressDownEx(const char *label,
                                                                     const ButtonComboModule_ControllerTypes controllerMask,
                                                                     const ButtonComboModule_Buttons combo,
@@ -260,6 +593,56 @@ ButtonComboModule_Error ButtonComboModule_AddButtonComboPressDownObserver(const
     return ButtonComboModule_AddButtonComboPressDownEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, callback, context, true, outHandle, outStatus);
 }
 
+ButtonComboModule_Error ButtonComboModule_AddButtonComboPressDownFiltered(const char *label,
+                                                                          const ButtonComboModule_ControllerTypes controllerMask,
+                                                                          const ButtonComboModule_Buttons combo,
+                                                                          const uint32_t cooldownInMs,
+                                                                          const uint32_t debounceInMs,
+                                                                          const ButtonComboModule_ComboCallback callback,
+                                                                          void *context,
+                                                                          const bool observer,
+                                                                          ButtonComboModule_ComboHandle *outHandle,
+                                                                          ButtonComboModule_ComboStatus *outStatus) {
+    ButtonComboModule_ComboOptions options               = {};
+    options.version                                      = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EX;
+    options.metaOptions.label                            = label;
+    options.callbackOptions                              = {.callback = callback, .context = context};
+    options.buttonComboOptions.type                      = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+    options.buttonComboOptions.basicCombo.combo          = combo;
+    options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
+    options.triggerFilter                                = {.version = BUTTON_COMBO_MODULE_TRIGGER_FILTER_VERSION, .cooldownInMs = cooldownInMs, .debounceInMs = debounceInMs};
+
+    return ButtonComboModule_AddButtonCombo(&options, outHandle, outStatus);
+}
+
+ButtonComboModule_Error ButtonComboModule_AddButtonComboExpression(const char *label,
+                                                                   const ButtonComboModule_ControllerTypes controllerMask,
+                                                                   const ButtonComboModule_ComboExpression *expression,
+                                                                   const uint32_t holdDurationInMs,
+                                                                   const ButtonComboModule_ComboCallback callback,
+                                                                   void *context,
+                                                                   const bool observer,
+                                                                   ButtonComboModule_ComboHandle *outHandle,
+                                                                   ButtonComboModule_ComboStatus *outStatus) {
+    if (expression == nullptr) {
+        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
+    }
+    ButtonComboModule_ComboOptions options = {};
+    options.version                        = BUTTON_COMBO_MODULE_COMBO_OPTIONS_VERSION_EXPRESSION;
+    options.metaOptions.label              = label;
+    options.callbackOptions                = {.callback = callback, .context = context};
+    if (holdDurationInMs > 0) {
+        options.buttonComboOptions.type = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_HOLD;
+    } else {
+        options.buttonComboOptions.type = observer ? BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN_OBSERVER : BUTTON_COMBO_MODULE_COMBO_TYPE_PRESS_DOWN;
+    }
+    options.buttonComboOptions.basicCombo.controllerMask = controllerMask;
+    options.buttonComboOptions.optionalHoldForXMs        = holdDurationInMs;
+    options.expression                                   = *expression;
+
+    return ButtonComboModule_AddButtonCombo(&options, outHandle, outStatus);
+}
+
 ButtonComboModule_Error ButtonComboModule_AddButtonComboHoldEx(const char *label,
                                                                const ButtonComboModule_ControllerTypes controllerMask,
                                                                const ButtonComboModule_Buttons combo,
@@ -299,199 +682,4 @@ ButtonComboModule_Error ButtonComboModule_AddButtonComboHoldObserver(const char
                                                                      ButtonComboModule_ComboHandle *outHandle,
                                                                      ButtonComboModule_ComboStatus *outStatus) {
     return ButtonComboModule_AddButtonComboHoldEx(label, BUTTON_COMBO_MODULE_CONTROLLER_ALL, combo, holdDurationInMs, callback, context, true, outHandle, outStatus);
-}
-
-ButtonComboModule_Error ButtonComboModule_RemoveButtonCombo(const ButtonComboModule_ComboHandle handle) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMRemoveButtonComboFn == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMRemoveButtonComboFn(handle);
-}
-
-
-ButtonComboModule_Error ButtonComboModule_GetButtonComboStatus(const ButtonComboModule_ComboHandle handle,
-                                                               ButtonComboModule_ComboStatus *outStatus) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMGetButtonComboStatus == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || outStatus == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMGetButtonComboStatus(handle, outStatus);
-}
-
-
-ButtonComboModule_Error ButtonComboModule_UpdateButtonComboMeta(const ButtonComboModule_ComboHandle handle,
-                                                                const ButtonComboModule_MetaOptions *metaOptions) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMUpdateButtonComboMeta == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || metaOptions == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMUpdateButtonComboMeta(handle, metaOptions);
-}
-
-ButtonComboModule_Error ButtonComboModule_UpdateButtonComboCallback(const ButtonComboModule_ComboHandle handle,
-                                                                    const ButtonComboModule_CallbackOptions *callbackOptions) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMUpdateButtonComboCallback == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || callbackOptions == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMUpdateButtonComboCallback(handle, callbackOptions);
-}
-
-ButtonComboModule_Error ButtonComboModule_UpdateControllerMask(const ButtonComboModule_ComboHandle handle,
-                                                               const ButtonComboModule_ControllerTypes controllerMask,
-                                                               ButtonComboModule_ComboStatus *outStatus) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMUpdateControllerMask == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMUpdateControllerMask(handle, controllerMask, outStatus);
-}
-
-ButtonComboModule_Error ButtonComboModule_UpdateButtonCombo(const ButtonComboModule_ComboHandle handle,
-                                                            const ButtonComboModule_Buttons combo,
-                                                            ButtonComboModule_ComboStatus *outStatus) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMUpdateButtonCombo == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMUpdateButtonCombo(handle, combo, outStatus);
-}
-
-ButtonComboModule_Error ButtonComboModule_UpdateHoldDuration(const ButtonComboModule_ComboHandle handle,
-                                                             const uint32_t holdDurationInMs) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMUpdateHoldDuration == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMUpdateHoldDuration(handle, holdDurationInMs);
-}
-
-ButtonComboModule_Error ButtonComboModule_GetButtonComboMeta(const ButtonComboModule_ComboHandle handle,
-                                                             ButtonComboModule_MetaOptionsOut *outOptions) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMGetButtonComboMeta == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || outOptions == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMGetButtonComboMeta(handle, outOptions);
-}
-
-ButtonComboModule_Error ButtonComboModule_GetButtonComboCallback(const ButtonComboModule_ComboHandle handle,
-                                                                 ButtonComboModule_CallbackOptions *outOptions) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMGetButtonComboCallback == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || outOptions == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMGetButtonComboCallback(handle, outOptions);
-}
-
-ButtonComboModule_Error ButtonComboModule_GetButtonComboInfoEx(const ButtonComboModule_ComboHandle handle,
-                                                               ButtonComboModule_ButtonComboInfoEx *outOptions) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMGetButtonComboInfoEx == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (handle == nullptr || outOptions == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMGetButtonComboInfoEx(handle, outOptions);
-}
-
-ButtonComboModule_Error ButtonComboModule_CheckComboAvailable(const ButtonComboModule_ButtonComboOptions *options,
-                                                              ButtonComboModule_ComboStatus *outStatus) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMCheckComboAvailable == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (options == nullptr || outStatus == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMCheckComboAvailable(options, outStatus);
-}
-
-ButtonComboModule_Error ButtonComboModule_DetectButtonCombo_Blocking(const ButtonComboModule_DetectButtonComboOptions *options,
-                                                                     ButtonComboModule_Buttons *outButtons) {
-    if (sButtonComboModuleVersion == BUTTON_COMBO_MODULE_API_VERSION_ERROR) {
-        return BUTTON_COMBO_MODULE_ERROR_LIB_UNINITIALIZED;
-    }
-    if (sBCMDetectButtonComboBlocking == nullptr || sButtonComboModuleVersion < 1) {
-        return BUTTON_COMBO_MODULE_ERROR_UNSUPPORTED_COMMAND;
-    }
-
-    if (options == nullptr || outButtons == nullptr) {
-        return BUTTON_COMBO_MODULE_ERROR_INVALID_ARGUMENT;
-    }
-
-    return sBCMDetectButtonComboBlocking(options, outButtons);
 }
\ No newline at end of file
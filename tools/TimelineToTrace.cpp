@@ -0,0 +1,52 @@
+#include <buttoncombo/ButtonComboTimeline.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+/**
+ * Converts a timeline dump written by ButtonComboModule_WriteTimelineDump (e.g. copied from the SD card of a console)
+ * to Chrome trace event JSON. The JSON is written to stdout, or to the file passed as second argument.
+ */
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <timeline dump> [output.json]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "rb");
+    if (in == nullptr) {
+        fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> dump;
+    uint8_t chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        dump.insert(dump.end(), chunk, chunk + read);
+    }
+    fclose(in);
+
+    const ButtonComboModule::TimelineDumpView view(dump.data(), static_cast<uint32_t>(dump.size()));
+    if (!view.IsValid()) {
+        fprintf(stderr, "%s is not a valid timeline dump\n", argv[1]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+    if (argc > 2 && (out = fopen(argv[2], "w")) == nullptr) {
+        fprintf(stderr, "Failed to open %s\n", argv[2]);
+        return 1;
+    }
+    ButtonComboModule::WriteChromeTrace(view, [out](const std::string_view str) {
+        fwrite(str.data(), 1, str.size(), out);
+    });
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    fprintf(stderr, "Converted %" PRIu32 " event(s) of %" PRIu32 " combo(s), %" PRIu32 " event(s) had been dropped\n", view.GetEventCount(), view.GetComboCount(), view.GetDroppedCount());
+    return 0;
+}
\ No newline at end of file